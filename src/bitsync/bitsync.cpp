@@ -49,8 +49,11 @@ Options::Options()
 
     impl_token                          = Impl::impl_unknown;
     corr_mm                             = Impl::corr_muliply_unknown;
+    simd_token                          = Impl::simd_unknown;
+    corr_value_token                    = Impl::corr_value_unknown;
     stream_byte_size                    = 0;
     stream_bit_size                     = 0;
+    stream_chunk_byte_size              = DEFAULT_STREAM_CHUNK_BYTE_SIZE;
     stream_min_period                   = math::uint32_max;
     stream_max_period                   = math::uint32_max;
     max_periods_in_offset               = DEFAULT_MAX_PERIODS_IN_OFFSET;
@@ -68,7 +71,13 @@ Options::Options()
     insert_output_syncseq_period_repeat = math::uint32_max;
     corr_min                            = math::float_max;
     corr_mean_min                       = math::float_max;
+    track_drift_bit_size                = DEFAULT_TRACK_DRIFT_BIT_SIZE;
+    track_max_misses                    = DEFAULT_TRACK_MAX_MISSES;
+    track_corr_min                      = math::float_max;
     corr_mean_buf_max_size_mb           = DEFAULT_CORR_MEAN_BUF_MAX_SIZE_MB;
+    num_threads                         = 1;
+    autocorr_fft_min_size               = DEFAULT_AUTOCORR_FFT_MIN_SIZE;
+    remap_sync_variants                 = DEFAULT_REMAP_SYNC_VARIANTS;
 }
 
 bool Options::is_corr_mm_default() const
@@ -92,6 +101,9 @@ void Options::update_impl_token_defaults()
     case Impl::impl_max_weighted_autocorr_of_corr_values:
         impl_token_str = _T("weighted-autocorr-of-corr-values");
         break;
+    case Impl::impl_ensemble_of_corr_mean:
+        impl_token_str = _T("ensemble-of-corr-mean");
+        break;
     default:
         assert(0);
     }
@@ -115,6 +127,51 @@ void Options::update_corr_mm_defaults()
     }
 }
 
+void Options::update_simd_token_defaults()
+{
+    if (simd_token == Impl::simd_unknown) {
+        simd_token = get_corr_simd_default();
+    }
+
+    switch (simd_token) {
+    case Impl::simd_scalar:
+        simd_token_str = _T("scalar");
+        break;
+    case Impl::simd_sse42:
+        simd_token_str = _T("sse42");
+        break;
+    case Impl::simd_avx2:
+        simd_token_str = _T("avx2");
+        break;
+    case Impl::simd_avx512:
+        simd_token_str = _T("avx512");
+        break;
+    default:
+        assert(0);
+    }
+}
+
+void Options::update_corr_value_token_defaults()
+{
+    if (corr_value_token == Impl::corr_value_unknown) {
+        corr_value_token = Impl::corr_value_float32;
+    }
+
+    switch (corr_value_token) {
+    case Impl::corr_value_float32:
+        corr_value_token_str = _T("float32");
+        break;
+    case Impl::corr_value_fixed16:
+        corr_value_token_str = _T("fixed16");
+        break;
+    case Impl::corr_value_fixed8:
+        corr_value_token_str = _T("fixed8");
+        break;
+    default:
+        assert(0);
+    }
+}
+
 void Options::update_corr_min_defaults(const Flags & flags)
 {
     if (corr_min == math::float_max)
@@ -136,6 +193,16 @@ void Options::update_corr_min_defaults(const Flags & flags)
             corr_mean_min = DEFAULT_QUADRATIC_CORR_MEAN_MIN;
         }
     }
+
+    if (track_corr_min == math::float_max)
+    {
+        if (flags.use_linear_corr) {
+            track_corr_min = DEFAULT_LINEAR_TRACK_CORR_MIN;
+        }
+        else {
+            track_corr_min = DEFAULT_QUADRATIC_TRACK_CORR_MIN;
+        }
+    }
 }
 
 void Options::clear()
@@ -145,11 +212,11 @@ void Options::clear()
 
 // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
 //
-inline void generate_noise(const BasicData & basic_data, StreamParams & stream_params, NoiseParams & noise_params, uint8_t * buf, uint32_t size)
+inline void generate_noise(const BasicData & basic_data, StreamParams & stream_params, NoiseParams & noise_params, uint8_t * buf, uint64_t size)
 {
     uint8_t * buf_out = buf;
 
-    const uint64_t stream_bit_size = size * 8;
+    const uint64_t stream_bit_size = uint64_t(size) * 8;
 
     const uint64_t stream_bit_start_offset = stream_params.last_bit_offset;
 
@@ -293,7 +360,7 @@ inline void write_syncseq(
     assert(syncseq_bit_size);
     assert(period);
 
-    const uint64_t stream_bit_size = size * 8;
+    const uint64_t stream_bit_size = uint64_t(size) * 8;
     assert(first_offset < stream_bit_size);
     assert(first_offset < end_offset);
 
@@ -435,64 +502,81 @@ inline void write_syncseq(
     }
 }
 
-// Buffer be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+// Makes the bytes translation table of the bauds from the start baud alphabet sequence into the end baud alphabet sequence. A baud out of the
+// start baud alphabet sequence is not translated.
 //
-void generate_stream(GenData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size)
+inline void make_baud_translate_table(const GenData & data, BaudTranslateTable & table)
 {
-    if (!!data.basic_data.options_ptr->stream_byte_size) {
-        state.break_ = true;
-    }
+    const uint32_t bits_per_baud = data.basic_data.options_ptr->bits_per_baud;
 
-    // Buffer is already padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
-    //
-    const uint32_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+    assert(bits_per_baud == 1 || bits_per_baud == 2);
 
-    // zeroing padding bytes
-    for (uint32_t i = size; i < padded_stream_byte_size; i++) {
-        buf[i] = 0;
-    }
+    for (uint32_t n = 0; n < 16; n++) {
+        uint32_t to_nibble = 0;
 
-    if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
-        StreamParams stream_params{ data.stream_params };
-        NoiseParams noise_params{ data.noise_params };
-        generate_noise(data.basic_data, stream_params, noise_params, buf, size); // CAUTION: params copy must be copied!
-    }
+        for (uint32_t j = 0; j < 4; j += bits_per_baud) {
+            const uint8_t baud_char = uint8_t(n >> j) & data.baud_mask;
+            uint8_t to_baud_char = baud_char;
 
-    // tee preprocessed input
-    if (data.basic_data.tee_file_in_handle.get()) {
-        const size_t write_size = fwrite(buf, 1, size, data.basic_data.tee_file_in_handle.get());
-        const int file_write_err = ferror(data.basic_data.tee_file_in_handle.get());
-        if (write_size < size) {
-            utility::debug_break();
-#ifdef _UNICODE
-            throw std::system_error{ file_write_err, std::system_category(), utility::convert_string_to_string(data.basic_data.tee_file_in_handle.path(), utility::tag_string{}, utility::int_identity<utility::StringConv_utf16_to_utf8>{}) };
-#else
-            throw std::system_error{ file_write_err, std::system_category(), data.basic_data.tee_file_in_handle.path() };
-#endif
+            for (uint32_t i = 0; i < data.baud_capacity; i++) {
+                if ((*data.baud_alphabet_start_sequence)[i] == baud_char) {
+                    to_baud_char = (*data.baud_alphabet_end_sequence)[i];
+                    break;
+                }
+            }
+
+            to_nibble |= uint32_t(to_baud_char) << j;
         }
-    }
 
-    utility::Buffer write_buf{ padded_stream_byte_size };
+        table.low_nibble_arr[n] = uint8_t(to_nibble);
+        table.high_nibble_arr[n] = uint8_t(to_nibble << 4);
+    }
 
-    uint8_t * buf_out = write_buf.get();
+    for (uint32_t i = 0; i < 256; i++) {
+        table.byte_arr[i] = uint8_t(table.low_nibble_arr[i & 0x0f] | table.high_nibble_arr[i >> 4]);
+    }
+}
 
+// Translates the bauds of the stream from the start baud alphabet sequence into the end baud alphabet sequence beginning from the last bit
+// offset plus the shifted bit offset. The bits out of the translated bauds are not changed in the output buffer.
+//
+//  The bauds of 1 or 2 bits of a whole number of bytes are translated by the bytes translation table, where a shifted byte is translated as
+//  a byte pair of the output.
+//
+// Buffers must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+//
+inline void translate_bauds(GenData & data, const uint8_t * buf, uint8_t * buf_out, uint64_t stream_bit_size)
+{
     const uint32_t bits_per_baud = data.basic_data.options_ptr->bits_per_baud;
 
-    const uint64_t stream_bit_size = size * 8;
-
-    const uint32_t num_wholes = uint32_t(stream_bit_size / bits_per_baud);
+    const uint64_t num_wholes = stream_bit_size / bits_per_baud;
     //const uint32_t remainder = uint32_t(stream_bit_size % bits_per_baud);
 
-    const uint64_t stream_bit_start_offset = data.stream_params.last_bit_offset;
+    uint64_t stream_bit_offset = data.stream_params.last_bit_offset;
 
-    uint64_t stream_bit_offset = stream_bit_start_offset;
+    const uint32_t first_shifted_bit_offset = uint32_t(stream_bit_offset % 8) + data.shifted_bit_offset;
+
+    if ((bits_per_baud == 1 || bits_per_baud == 2) && !(num_wholes * bits_per_baud % 8) && first_shifted_bit_offset < 8) {
+        BaudTranslateTable baud_translate_table;
+
+        make_baud_translate_table(data, baud_translate_table);
+
+        const uint64_t byte_offset = stream_bit_offset / 8;
+
+        get_corr_simd_kernels(data.basic_data.options_ptr->simd_token).translate_bytes(
+            baud_translate_table, buf + byte_offset, size_t(num_wholes * bits_per_baud / 8), first_shifted_bit_offset, buf_out + byte_offset);
+
+        data.stream_params.last_bit_offset = stream_bit_offset + num_wholes * bits_per_baud;
+
+        return;
+    }
 
-    for (uint32_t i = 0; i < num_wholes; i++)
+    for (uint64_t i = 0; i < num_wholes; i++)
     {
         const uint64_t byte_offset = stream_bit_offset / 8;
         const uint32_t remain_bit_offset = (stream_bit_offset % 8) + data.shifted_bit_offset;
 
-        uint32_t buf32 = *(uint32_t *)(buf + byte_offset);
+        uint32_t buf32 = *(const uint32_t *)(buf + byte_offset);
 
         const uint8_t baud_char = uint8_t(buf32 >> remain_bit_offset) & data.baud_mask;
         uint8_t to_baud_char = baud_char;
@@ -512,6 +596,33 @@ void generate_stream(GenData & data, tackle::file_reader_state & state, uint8_t
     }
 
     data.stream_params.last_bit_offset = stream_bit_offset;
+}
+
+// Translates the bauds of a chunk of a variant, inserts the synchro sequence and writes the output file of the variant.
+//
+// Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+//
+inline void write_variant_stream(GenData & data, const uint8_t * buf, uint32_t size)
+{
+    const uint64_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+
+    // the output buffer is allocated by the first chunk
+    if (data.write_buf.size() < padded_stream_byte_size) {
+        data.write_buf.resize(size_t(padded_stream_byte_size));
+    }
+
+    uint8_t * buf_out = data.write_buf.data();
+
+    const uint64_t stream_bit_size = uint64_t(size) * 8;
+
+    const uint64_t stream_bit_start_offset = data.stream_params.last_bit_offset;
+
+    // the bits before the first translated baud are copied from the input
+    const uint64_t first_baud_byte_offset = (stream_bit_start_offset + data.shifted_bit_offset) / 8;
+
+    std::copy(buf, buf + size_t((std::min)(first_baud_byte_offset + 1, uint64_t(size))), buf_out);
+
+    translate_bauds(data, buf, buf_out, stream_bit_size);
 
     uint64_t syncseq_first_offset = 0;
 
@@ -553,6 +664,49 @@ void generate_stream(GenData & data, tackle::file_reader_state & state, uint8_t
     }
 }
 
+// Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+//
+void generate_variant_streams(GenVariantsData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size)
+{
+    if (!!data.basic_data.options_ptr->stream_byte_size) {
+        state.break_ = true;
+    }
+
+    // Buffer is already padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+    //
+    const uint64_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+
+    // zeroing padding bytes
+    for (uint64_t i = size; i < padded_stream_byte_size; i++) {
+        buf[i] = 0;
+    }
+
+    if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
+        StreamParams stream_params{ data.stream_params };
+        NoiseParams noise_params{ data.noise_params };
+        generate_noise(data.basic_data, stream_params, noise_params, buf, size); // CAUTION: params copy must be copied!
+    }
+
+    // tee preprocessed input
+    if (data.basic_data.tee_file_in_handle.get()) {
+        const size_t write_size = fwrite(buf, 1, size, data.basic_data.tee_file_in_handle.get());
+        const int file_write_err = ferror(data.basic_data.tee_file_in_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+#ifdef _UNICODE
+            throw std::system_error{ file_write_err, std::system_category(), utility::convert_string_to_string(data.basic_data.tee_file_in_handle.path(), utility::tag_string{}, utility::int_identity<utility::StringConv_utf16_to_utf8>{}) };
+#else
+            throw std::system_error{ file_write_err, std::system_category(), data.basic_data.tee_file_in_handle.path() };
+#endif
+        }
+    }
+
+    // the chunk is read once for all the variants
+    data.pool_ptr->run(data.variant_data_arr.size(), [&](size_t, uint64_t variant_index) {
+        write_variant_stream(data.variant_data_arr[size_t(variant_index)], buf, size);
+    });
+}
+
 // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
 //
 inline void pipe_stream(PipeData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size)
@@ -561,16 +715,16 @@ inline void pipe_stream(PipeData & data, tackle::file_reader_state & state, uint
         state.break_ = true;
     }
 
-    const uint64_t stream_bit_size = size * 8;
+    const uint64_t stream_bit_size = uint64_t(size) * 8;
 
     const uint64_t stream_bit_start_offset = data.stream_params.last_bit_offset;
 
     // Buffer is already padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
     //
-    const uint32_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+    const uint64_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
 
     // zeroing padding bytes
-    for (uint32_t i = size; i < padded_stream_byte_size; i++) {
+    for (uint64_t i = size; i < padded_stream_byte_size; i++) {
         buf[i] = 0;
     }
 
@@ -631,74 +785,20 @@ inline void pipe_stream(PipeData & data, tackle::file_reader_state & state, uint
     }
 }
 
-// Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+// Selects the synchro sequence offset and period of the first periodic result of the implementation.
 //
-void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size)
+inline void select_synchro_sequence(
+    SyncData & data, const std::vector<SyncseqCorr> & corr_autocorr_arr, SyncseqCorrMeanSoA & corr_max_mean_sum_arena,
+    SyncseqCorrMeanDeviatSoA & corr_min_mean_deviat_sum_arena)
 {
-    // not found
-    data.syncseq_bit_offset = math::uint32_max;
-
-    // first time read size must be greater than 32 bits
-    //
-    if (!state.read_index && 32 >= size) {
-        return;
-    }
-
-    // single read only
-    state.break_ = true;
-
-    // Buffer is already padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
-    //
-    const uint32_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
-
-    // zeroing padding bytes
-    for (uint32_t i = size; i < padded_stream_byte_size; i++) {
-        buf[i] = 0;
-    }
-
-    if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
-        StreamParams stream_params{ data.stream_params };
-        NoiseParams noise_params{ data.noise_params };
-        generate_noise(data.basic_data, stream_params, noise_params, buf, size); // CAUTION: params copy must be copied!
-    }
-
-    // tee preprocessed input
-    if (data.basic_data.tee_file_in_handle.get()) {
-        const size_t write_size = fwrite(buf, 1, size, data.basic_data.tee_file_in_handle.get());
-        const int file_write_err = ferror(data.basic_data.tee_file_in_handle.get());
-        if (write_size < size) {
-            utility::debug_break();
-#ifdef _UNICODE
-            throw std::system_error{ file_write_err, std::system_category(), utility::convert_string_to_string(data.basic_data.tee_file_in_handle.path(), utility::tag_string{}, utility::int_identity<utility::StringConv_utf16_to_utf8>{}) };
-#else
-            throw std::system_error{ file_write_err, std::system_category(), data.basic_data.tee_file_in_handle.path() };
-#endif
-        }
-    }
-
-    // calculate synchro sequence correlation values and correlation mean values
-
-    data.stream_params.stream_width = math::uint32_max; // print other calculated values
-
-    std::vector<float> corr_values_arr;
-    std::vector<SyncseqCorr> corr_autocorr_arr;
-    std::deque<SyncseqCorrMean> corr_max_mean_sum_deq;
-    std::deque<SyncseqCorrMeanDeviat> corr_min_mean_deviat_sum_deq;
-
-    calculate_syncseq_correlation(
-        data.corr_in_params,
-        data.corr_io_params,
-        data.corr_out_params,
-        buf,
-        corr_values_arr,
-        corr_autocorr_arr,
-        corr_max_mean_sum_deq,
-        corr_min_mean_deviat_sum_deq);
-
     switch (g_options.impl_token) {
-    case Impl::impl_max_weighted_sum_of_corr_mean: {
-        if (!corr_max_mean_sum_deq.empty()) {
-            for (const auto & corr_max_mean_sum_ref : corr_max_mean_sum_deq) {
+    case Impl::impl_max_weighted_sum_of_corr_mean:
+    case Impl::impl_ensemble_of_corr_mean: {
+        // the ensemble result is of the maximum weighted sum of correlation mean values as the most resistant to the input noise
+        if (!corr_max_mean_sum_arena.empty()) {
+            for (size_t i = 0; i < corr_max_mean_sum_arena.size(); i++) {
+                const auto corr_max_mean_sum_ref = corr_max_mean_sum_arena[i];
+
                 // use only first periodic value
                 if (corr_max_mean_sum_ref.period) {
                     data.syncseq_bit_offset = corr_max_mean_sum_ref.offset;
@@ -709,11 +809,33 @@ void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state,
                 }
             }
         }
+
+        if (g_options.impl_token != Impl::impl_ensemble_of_corr_mean) {
+            break;
+        }
+
+        // the result of the minimum sum of correlation mean deviation values to cross check
+        if (!corr_min_mean_deviat_sum_arena.empty()) {
+            for (size_t i = 0; i < corr_min_mean_deviat_sum_arena.size(); i++) {
+                const auto corr_min_mean_deviat_sum_ref = corr_min_mean_deviat_sum_arena[i];
+
+                // use only first periodic value
+                if (corr_min_mean_deviat_sum_ref.period) {
+                    data.ensemble_syncseq_bit_offset = corr_min_mean_deviat_sum_ref.offset;
+                    data.ensemble_stream_width = corr_min_mean_deviat_sum_ref.period;
+                    break;
+                }
+            }
+        }
+
+        data.ensemble_agreement = data.syncseq_bit_offset == data.ensemble_syncseq_bit_offset && data.stream_params.stream_width == data.ensemble_stream_width;
     } break;
 
     case Impl::impl_min_sum_of_corr_mean_deviat: {
-        if (!corr_min_mean_deviat_sum_deq.empty()) {
-            for (const auto & corr_min_mean_deviat_sum_ref : corr_min_mean_deviat_sum_deq) {
+        if (!corr_min_mean_deviat_sum_arena.empty()) {
+            for (size_t i = 0; i < corr_min_mean_deviat_sum_arena.size(); i++) {
+                const auto corr_min_mean_deviat_sum_ref = corr_min_mean_deviat_sum_arena[i];
+
                 // use only first periodic value
                 if (corr_min_mean_deviat_sum_ref.period) {
                     data.syncseq_bit_offset = corr_min_mean_deviat_sum_ref.offset;
@@ -750,6 +872,47 @@ void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state,
         assert(0); // not implemented
     } break;
     }
+}
+
+// Makes the pool of each worker of a pool to calculate the correlation of an item by the worker. The pools are made once to be reused between
+// the items.
+//
+inline std::vector<std::unique_ptr<WorkStealingPool> > make_worker_pools(const WorkStealingPool & pool, uint32_t num_threads)
+{
+    std::vector<std::unique_ptr<WorkStealingPool> > worker_pool_arr(pool.num_workers());
+
+    for (auto & worker_pool_ptr : worker_pool_arr) {
+        worker_pool_ptr.reset(new WorkStealingPool{ num_threads });
+    }
+
+    return worker_pool_arr;
+}
+
+// Calculates the synchro sequence offset and period of a whole preprocessed stream in the buffer.
+//
+inline void calculate_synchro_sequence(WorkStealingPool & pool, SyncData & data, uint8_t * buf)
+{
+    // calculate synchro sequence correlation values and correlation mean values
+
+    data.stream_params.stream_width = math::uint32_max; // print other calculated values
+
+    CorrValues corr_values;
+    std::vector<SyncseqCorr> corr_autocorr_arr;
+    SyncseqCorrMeanSoA corr_max_mean_sum_arena;
+    SyncseqCorrMeanDeviatSoA corr_min_mean_deviat_sum_arena;
+
+    calculate_syncseq_correlation(
+        pool,
+        data.corr_in_params,
+        data.corr_io_params,
+        data.corr_out_params,
+        buf,
+        corr_values,
+        corr_autocorr_arr,
+        corr_max_mean_sum_arena,
+        corr_min_mean_deviat_sum_arena);
+
+    select_synchro_sequence(data, corr_autocorr_arr, corr_max_mean_sum_arena, corr_min_mean_deviat_sum_arena);
 
 #ifdef _DEBUG // DO NOT REMOVE: search algorithm false positive calculation code to test algorithm stability within input noise
     if (data.corr_out_params.input_inconsistency) {
@@ -783,9 +946,9 @@ void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state,
     // Example of expressions for the watch window in a debugger to represent statistical validity and certainty of the
     // correlation mean values output without next phases of an algorithm:
     //
-    //  &corr_max_mean_sum_deq[0],30                // weighted sums of correlation mean values and bit stream offset and period, sorted from weighted sum of correlation mean maximum value to minimum.
+    //  &corr_max_mean_sum_arena.corr_sum_arr[0],30 // weighted sums of correlation mean values and bit stream offset and period, sorted from weighted sum of correlation mean maximum value to minimum.
     //
-    //  &corr_min_mean_deviat_sum_deq[0],30         // sums of correlation mean deviation values and bit stream offset and period, sorted from sum of correlation mean deviation minimum value to maximum
+    //  &corr_min_mean_deviat_sum_arena.corr_sum_arr[0],30 // sums of correlation mean deviation values and bit stream offset and period, sorted from sum of correlation mean deviation minimum value to maximum
     //
     //  &false_in_true_corr_max_weighted_mean_sum_arr[0],30     // false positive correlation values within true positions, sorted from weighted sum of correlation mean maximum value to minimum
     //
@@ -822,59 +985,1117 @@ void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state,
     std::vector<SyncseqCorrMeanDeviatStats> false_in_true_corr_min_mean_deviat_sum_arr;
 
     calculate_syncseq_correlation_false_positive_stats(
-        corr_values_arr,
-        g_options.impl_token == Impl::impl_max_weighted_sum_of_corr_mean ? &corr_max_mean_sum_deq : nullptr,
-        g_options.impl_token == Impl::impl_min_sum_of_corr_mean_deviat ? &corr_min_mean_deviat_sum_deq : nullptr,
+        corr_values,
+        g_options.impl_token == Impl::impl_max_weighted_sum_of_corr_mean || g_options.impl_token == Impl::impl_ensemble_of_corr_mean ? &corr_max_mean_sum_arena : nullptr,
+        g_options.impl_token == Impl::impl_min_sum_of_corr_mean_deviat || g_options.impl_token == Impl::impl_ensemble_of_corr_mean ? &corr_min_mean_deviat_sum_arena : nullptr,
         true_positions_index_arr,
         true_num, 30,
         false_max_corr_arr, false_max_index_arr, true_max_corr_arr, true_max_index_arr,
         false_in_true_max_corr_arr, false_in_true_max_index_arr,
         saved_true_in_false_max_corr_arr, saved_true_in_false_max_index_arr,
-        g_options.impl_token == Impl::impl_max_weighted_sum_of_corr_mean ? &false_in_true_corr_max_weighted_mean_sum_arr : nullptr,
-        g_options.impl_token == Impl::impl_min_sum_of_corr_mean_deviat ? &false_in_true_corr_min_mean_deviat_sum_arr : nullptr);
+        g_options.impl_token == Impl::impl_max_weighted_sum_of_corr_mean || g_options.impl_token == Impl::impl_ensemble_of_corr_mean ? &false_in_true_corr_max_weighted_mean_sum_arr : nullptr,
+        g_options.impl_token == Impl::impl_min_sum_of_corr_mean_deviat || g_options.impl_token == Impl::impl_ensemble_of_corr_mean ? &false_in_true_corr_min_mean_deviat_sum_arr : nullptr);
 
     Sleep(0); // DO NOT REMOVE: for a debugger break point
 #endif
 }
 
-void read_file_chunk(uint8_t * buf, uint64_t size, void * user_data, tackle::file_reader_state & state)
+// Calculates the correlation values of all the synchro sequences of the options by a single pass over the stream and the rest phases of each
+// synchro sequence in parallel. The result of the search is the result of the synchro sequence with the maximum correlation mean value.
+//
+inline void calculate_synchro_sequences(WorkStealingPool & pool, SyncData & data, uint8_t * buf)
 {
-    if (sizeof(size_t) < sizeof(uint64_t)) {
-        const uint64_t max_value = uint64_t(math::size_max);
-        if (size > max_value) {
-            throw std::runtime_error(fmt::format("size is out of buffer: size={:d}", size));
-        }
+    const Options & options = *data.basic_data.options_ptr;
+
+    const size_t num_syncseqs = options.syncseq_int32_arr.size();
+
+    assert(options.syncseq_bit_size_arr.size() == num_syncseqs);
+
+    std::vector<CorrInParams> corr_in_params_arr(num_syncseqs, data.corr_in_params);
+    std::vector<CorrInOutParams> corr_io_params_arr(num_syncseqs, data.corr_io_params);
+    std::vector<CorrOutParams> corr_out_params_arr(num_syncseqs, data.corr_out_params);
+    std::vector<CorrValues> corr_values_arr;
+
+    for (size_t i = 0; i < num_syncseqs; i++) {
+        corr_in_params_arr[i].syncseq_bit_size = options.syncseq_bit_size_arr[i];
+        corr_io_params_arr[i].syncseq_int32 = options.syncseq_int32_arr[i];
     }
 
-    ReadFileChunkData & read_file_chunk_data = *static_cast<ReadFileChunkData *>(user_data);
+    calculate_syncseq_corr_values(corr_in_params_arr, corr_io_params_arr, corr_out_params_arr, buf, corr_values_arr);
 
-    switch (read_file_chunk_data.mode)
-    {
-    case Mode_Gen:
-    {
-        GenData & data = *static_cast<GenData *>(read_file_chunk_data.mode_data);
+    std::vector<SyncData> sync_data_arr;
 
-        const size_t read_size = uint32_t(size);
+    sync_data_arr.reserve(num_syncseqs);
 
-        generate_stream(data, state, buf, read_size);
-    } break;
+    for (size_t i = 0; i < num_syncseqs; i++) {
+        sync_data_arr.push_back(SyncData{
+            data.basic_data,
+            math::uint64_max,
+            data.stream_params,
+            data.noise_params,
+            corr_in_params_arr[i],
+            corr_io_params_arr[i],
+            std::move(corr_out_params_arr[i]),
+            math::uint64_max,
+            math::uint32_max,
+            false,
+            {}
+        });
 
-    case Mode_Sync:
-    {
-        SyncData & data = *static_cast<SyncData *>(read_file_chunk_data.mode_data);
+        SyncData & sync_data = sync_data_arr.back();
 
-        const size_t read_size = uint32_t(size);
+        // the synchro sequences are calculated in parallel, so each synchro sequence is calculated by a single thread
+        sync_data.corr_in_params.num_threads = 1;
+        sync_data.stream_params.stream_width = math::uint32_max; // print other calculated values
+    }
 
-        search_synchro_sequence(data, state, buf, read_size);
-    } break;
+    const std::vector<std::unique_ptr<WorkStealingPool> > worker_pool_arr = make_worker_pools(pool, 1);
 
-    case Mode_Pipe:
-    {
-        PipeData & data = *static_cast<PipeData *>(read_file_chunk_data.mode_data);
+    pool.run(num_syncseqs, [&](size_t worker_index, uint64_t syncseq_index) {
+        SyncData & sync_data = sync_data_arr[size_t(syncseq_index)];
+        CorrValues & corr_values = corr_values_arr[size_t(syncseq_index)];
 
-        const size_t read_size = uint32_t(size);
+        std::vector<SyncseqCorr> corr_autocorr_arr;
+        SyncseqCorrMeanSoA corr_max_mean_sum_arena;
+        SyncseqCorrMeanDeviatSoA corr_min_mean_deviat_sum_arena;
 
-        pipe_stream(data, state, buf, read_size);
+        calculate_syncseq_correlation_of_corr_values(
+            *worker_pool_arr[worker_index],
+            sync_data.corr_in_params,
+            sync_data.corr_io_params,
+            sync_data.corr_out_params,
+            corr_values,
+            corr_autocorr_arr,
+            corr_max_mean_sum_arena,
+            corr_min_mean_deviat_sum_arena);
+
+        select_synchro_sequence(sync_data, corr_autocorr_arr, corr_max_mean_sum_arena, corr_min_mean_deviat_sum_arena);
+
+        // release the correlation values as early as possible
+        corr_values = CorrValues{};
+    });
+
+    std::vector<SyncPatternResult> pattern_result_arr;
+
+    pattern_result_arr.reserve(num_syncseqs);
+
+    size_t max_corr_mean_index = 0;
+
+    for (size_t i = 0; i < num_syncseqs; i++) {
+        const SyncData & sync_data = sync_data_arr[i];
+
+        SyncPatternResult pattern_result;
+
+        pattern_result.syncseq_int32 = sync_data.corr_io_params.syncseq_int32;
+        pattern_result.syncseq_bit_size = sync_data.corr_in_params.syncseq_bit_size;
+        pattern_result.syncseq_bit_offset = sync_data.syncseq_bit_offset;
+        pattern_result.stream_width = sync_data.stream_params.stream_width;
+        pattern_result.corr_mean = sync_data.corr_out_params.accum_corr_mean_calc ? sync_data.corr_out_params.used_corr_mean : math::float_max;
+        pattern_result.input_inconsistency = sync_data.corr_out_params.input_inconsistency;
+        pattern_result.uncertain = sync_data.corr_out_params.accum_corr_mean_quit;
+        pattern_result.disagreement = sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean && !sync_data.ensemble_agreement;
+
+        pattern_result_arr.push_back(pattern_result);
+
+        const SyncPatternResult & max_pattern_result = pattern_result_arr[max_corr_mean_index];
+
+        const bool is_found = pattern_result.syncseq_bit_offset != math::uint64_max && pattern_result.stream_width != math::uint32_max;
+        const bool is_max_found = max_pattern_result.syncseq_bit_offset != math::uint64_max && max_pattern_result.stream_width != math::uint32_max;
+
+        // the first found synchro sequence in case of equal or not calculated correlation mean values
+        if (is_found && (!is_max_found ||
+            (pattern_result.corr_mean != math::float_max && (max_pattern_result.corr_mean == math::float_max || pattern_result.corr_mean > max_pattern_result.corr_mean)))) {
+            max_corr_mean_index = i;
+        }
+    }
+
+    const auto num_threads = data.corr_in_params.num_threads;
+
+    data = std::move(sync_data_arr[max_corr_mean_index]);
+
+    data.corr_in_params.num_threads = num_threads;
+    data.pattern_result_arr = std::move(pattern_result_arr);
+}
+
+// Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+//
+void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state, uint8_t * buf, uint64_t size)
+{
+    // not found
+    data.syncseq_bit_offset = math::uint64_max;
+    data.ensemble_syncseq_bit_offset = math::uint64_max;
+    data.ensemble_stream_width = math::uint32_max;
+    data.ensemble_agreement = false;
+
+    // first time read size must be greater than 32 bits
+    //
+    if (!state.read_index && 32 >= size) {
+        return;
+    }
+
+    // single read only
+    state.break_ = true;
+
+    // Buffer is already padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+    //
+    const uint64_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+
+    // zeroing padding bytes
+    for (uint64_t i = size; i < padded_stream_byte_size; i++) {
+        buf[i] = 0;
+    }
+
+    if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
+        StreamParams stream_params{ data.stream_params };
+        NoiseParams noise_params{ data.noise_params };
+        generate_noise(data.basic_data, stream_params, noise_params, buf, size); // CAUTION: params copy must be copied!
+    }
+
+    // tee preprocessed input
+    if (data.basic_data.tee_file_in_handle.get()) {
+        const size_t write_size = fwrite(buf, 1, size, data.basic_data.tee_file_in_handle.get());
+        const int file_write_err = ferror(data.basic_data.tee_file_in_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+#ifdef _UNICODE
+            throw std::system_error{ file_write_err, std::system_category(), utility::convert_string_to_string(data.basic_data.tee_file_in_handle.path(), utility::tag_string{}, utility::int_identity<utility::StringConv_utf16_to_utf8>{}) };
+#else
+            throw std::system_error{ file_write_err, std::system_category(), data.basic_data.tee_file_in_handle.path() };
+#endif
+        }
+    }
+
+    WorkStealingPool pool{ data.corr_in_params.num_threads };
+
+    if (data.basic_data.options_ptr->syncseq_int32_arr.size() > 1) {
+        calculate_synchro_sequences(pool, data, buf);
+    }
+    else {
+        calculate_synchro_sequence(pool, data, buf);
+    }
+}
+
+// Remaps the synchro sequence by the inverse of the baud alphabet sequence, where the synchro sequence does begin from the bit of a baud. The bits of
+// the partial bauds at the synchro sequence bounds can not be remapped and are out of the returned bit mask.
+//
+inline void remap_syncseq(
+    const GenSyncData & data, uint32_t baud_alphabet_sequence_index, uint32_t baud_bit_offset, uint32_t syncseq_value, uint32_t syncseq_bit_size,
+    uint32_t & remapped_syncseq_value, uint32_t & remapped_syncseq_bit_mask)
+{
+    const uint32_t bits_per_baud = data.basic_data.options_ptr->bits_per_baud;
+
+    const std::vector<uint8_t> & baud_alphabet_start_sequence = *data.baud_alphabet_start_sequence;
+    const std::vector<uint8_t> & baud_alphabet_end_sequence = (*data.baud_alphabet_sequences)[baud_alphabet_sequence_index];
+
+    remapped_syncseq_value = 0;
+    remapped_syncseq_bit_mask = 0;
+
+    for (uint32_t i = (bits_per_baud - baud_bit_offset) % bits_per_baud; i + bits_per_baud <= syncseq_bit_size; i += bits_per_baud) {
+        const uint8_t to_baud_char = uint8_t(syncseq_value >> i) & data.baud_mask;
+        uint8_t baud_char = to_baud_char;
+
+        for (uint32_t k = 0; k < data.baud_capacity; k++) {
+            if (baud_alphabet_end_sequence[k] == to_baud_char) {
+                baud_char = baud_alphabet_start_sequence[k];
+                break;
+            }
+        }
+
+        remapped_syncseq_value |= uint32_t(baud_char) << i;
+        remapped_syncseq_bit_mask |= data.baud_mask << i;
+    }
+}
+
+// Ranks the variants by the correlation values of the remapped synchro sequence in the not generated stream instead of the synchro sequence in each
+// generated stream.
+//
+//  A variant translates each baud by the same baud alphabet sequence, so the synchro sequence in a variant is the inverse translated synchro sequence
+//  in the input, where the remapped synchro sequence depends on the bit of a baud from which the synchro sequence does begin. So the correlation
+//  values of all the variants are calculated by a single pass over the input with a remapped synchro sequence per baud alphabet sequence and per bit
+//  of a baud, where the correlation value of a variant in an offset is selected by the bit of a baud of the offset in the variant.
+//
+//  The correlation values are equal to the values of the generated stream in the synchro sequence match, but can differ out of the match, because a
+//  baud translation does not keep the number of different bits and the bits of the partial bauds are not compared. So the variants are ranked by the
+//  mean of the top correlation values, where the number of the top values is the minimal number of the synchro sequence repeats in the stream.
+//
+//  Memory complexity:   O(V), where V - number of variants
+//  Time complexity:     O(N * S * M / 8), where N - stream bit length, S - number of baud alphabet sequences, M - synchro sequence bit length
+//
+inline void rank_remap_variants(
+    GenSyncData & data, const uint8_t * buf, uint64_t stream_bit_size, const std::vector<std::pair<uint32_t, uint32_t> > & variant_arr)
+{
+    const uint32_t bits_per_baud = data.basic_data.options_ptr->bits_per_baud;
+    const uint32_t num_baud_alphabet_sequences = uint32_t(data.baud_alphabet_sequences->size());
+
+    const CorrInParams & corr_in_params = data.corr_in_params;
+
+    const uint32_t syncseq_bit_size = corr_in_params.syncseq_bit_size;
+    const uint32_t syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
+    const uint32_t syncseq_bytes = data.corr_io_params.syncseq_int32 & syncseq_mask;
+
+    data.remap_variant_arr.clear();
+
+    if (variant_arr.empty() || stream_bit_size < syncseq_bit_size) {
+        return;
+    }
+
+    // the minimal number of the synchro sequence repeats in the stream
+    data.num_top_corr_values = uint32_t((std::max)(uint64_t(1),
+        corr_in_params.max_period != math::uint32_max ?
+            stream_bit_size / corr_in_params.max_period :
+            uint64_t(corr_in_params.period_min_repeat)));
+
+    // the remapped synchro sequences of the used baud alphabet sequences, a remapped synchro sequence per bit of a baud
+    std::vector<uint32_t> remap_index_arr(num_baud_alphabet_sequences, math::uint32_max);
+    std::vector<uint32_t> remapped_syncseq_arr;
+    std::vector<CorrMultiplyTable> corr_multiply_table_arr;
+    std::vector<float> syncseq_corr_absmax_arr;
+
+    for (const auto & variant : variant_arr) {
+        const uint32_t baud_alphabet_sequence_index = variant.second;
+
+        if (remap_index_arr[baud_alphabet_sequence_index] != math::uint32_max) {
+            continue;
+        }
+
+        remap_index_arr[baud_alphabet_sequence_index] = uint32_t(remapped_syncseq_arr.size());
+
+        for (uint32_t baud_bit_offset = 0; baud_bit_offset < bits_per_baud; baud_bit_offset++) {
+            uint32_t remapped_syncseq_value;
+            uint32_t remapped_syncseq_bit_mask;
+
+            remap_syncseq(data, baud_alphabet_sequence_index, baud_bit_offset, syncseq_bytes, syncseq_bit_size, remapped_syncseq_value, remapped_syncseq_bit_mask);
+
+            remapped_syncseq_arr.push_back(remapped_syncseq_value);
+
+            corr_multiply_table_arr.push_back(CorrMultiplyTable{});
+
+            make_corr_multiply_table(corr_in_params.corr_mm, remapped_syncseq_value, remapped_syncseq_bit_mask, syncseq_bit_size, corr_multiply_table_arr.back());
+
+            syncseq_corr_absmax_arr.push_back(multiply_bits(corr_multiply_table_arr.back().syncseq_arr, remapped_syncseq_value));
+        }
+    }
+
+    const size_t num_remapped_syncseqs = remapped_syncseq_arr.size();
+
+    const CorrSimdKernels & corr_simd_kernels = get_corr_simd_kernels(corr_in_params.simd_token);
+
+    // the offsets of the whole synchro sequence in the stream
+    const uint64_t num_corr_values = stream_bit_size - syncseq_bit_size + 1;
+    const uint64_t num_blocks = (num_corr_values + CORR_BLOCK_BIT_SIZE - 1) / CORR_BLOCK_BIT_SIZE;
+
+    // number of blocks of a work item
+    const uint64_t item_num_blocks = 256;
+
+    struct VariantTopCorr
+    {
+        std::vector<float>          top_corr_value_arr;     // minimum heap
+        uint64_t                    max_corr_offset;
+        float                       max_corr_value;
+    };
+
+    WorkStealingPool pool{ data.basic_data.options_ptr->num_threads };
+
+    std::vector<std::vector<VariantTopCorr> > worker_variant_top_corr_arr(pool.num_workers(),
+        std::vector<VariantTopCorr>(variant_arr.size(), VariantTopCorr{ std::vector<float>{}, math::uint64_max, 0 }));
+
+    std::vector<std::vector<float> > worker_corr_values_arr(pool.num_workers(), std::vector<float>(num_remapped_syncseqs * CORR_BLOCK_BIT_SIZE));
+
+    const uint32_t * stream_buf32 = (const uint32_t *)buf;
+
+    pool.run((num_blocks + item_num_blocks - 1) / item_num_blocks, [&](size_t worker_index, uint64_t item_index) {
+        std::vector<VariantTopCorr> & variant_top_corr_arr = worker_variant_top_corr_arr[worker_index];
+        float * corr_values_arr = worker_corr_values_arr[worker_index].data();
+
+        float stream_corr_absmax_arr[CORR_BLOCK_BIT_SIZE];
+        float multiplied_values_arr[CORR_BLOCK_BIT_SIZE];
+
+        const uint64_t first_block = item_index * item_num_blocks;
+        const uint64_t last_block = (std::min)(first_block + item_num_blocks, num_blocks);
+
+        for (uint64_t block_index = first_block; block_index < last_block; block_index++) {
+            const uint64_t block_offset = block_index * CORR_BLOCK_BIT_SIZE;
+            const size_t block_size = size_t((std::min)(uint64_t(CORR_BLOCK_BIT_SIZE), num_corr_values - block_offset));
+
+            const uint32_t * stream_block_buf32 = stream_buf32 + block_offset / 32;
+
+            // the stream block is loaded once for all the remapped synchro sequences
+            for (size_t i = 0; i < num_remapped_syncseqs; i++) {
+                const CorrMultiplyTable & corr_multiply_table = corr_multiply_table_arr[i];
+
+                corr_simd_kernels.multiply_bits_block(corr_multiply_table.stream_arr, stream_block_buf32, syncseq_mask, block_size, stream_corr_absmax_arr);
+                corr_simd_kernels.multiply_bits_block(corr_multiply_table.syncseq_arr, stream_block_buf32, syncseq_mask, block_size, multiplied_values_arr);
+
+                const CorrValuesBlockParams corr_values_block_params{
+                    syncseq_corr_absmax_arr[i],
+                    0,
+                    0,
+                    corr_in_params.use_linear_corr
+                };
+
+                CorrValuesBlockStats corr_values_block_stats{ math::float_max, 0, 0 };
+
+                corr_simd_kernels.calculate_corr_values_block(corr_values_block_params, multiplied_values_arr, stream_corr_absmax_arr, block_size,
+                    corr_values_arr + i * CORR_BLOCK_BIT_SIZE, corr_values_block_stats);
+            }
+
+            for (size_t v = 0; v < variant_arr.size(); v++) {
+                const uint32_t shifted_bit_offset = variant_arr[v].first;
+                const uint32_t remap_index = remap_index_arr[variant_arr[v].second];
+
+                VariantTopCorr & variant_top_corr = variant_top_corr_arr[v];
+                std::vector<float> & top_corr_value_arr = variant_top_corr.top_corr_value_arr;
+
+                for (size_t i = 0; i < block_size; i++) {
+                    const uint64_t offset = block_offset + i;
+
+                    // the bit of a baud of the offset in the variant
+                    const uint32_t baud_bit_offset = uint32_t((offset + bits_per_baud - shifted_bit_offset) % bits_per_baud);
+
+                    const float corr_value = corr_values_arr[(remap_index + baud_bit_offset) * CORR_BLOCK_BIT_SIZE + i];
+
+                    if (corr_value > variant_top_corr.max_corr_value) {
+                        variant_top_corr.max_corr_value = corr_value;
+                        variant_top_corr.max_corr_offset = offset;
+                    }
+
+                    if (top_corr_value_arr.size() < data.num_top_corr_values) {
+                        top_corr_value_arr.push_back(corr_value);
+                        std::push_heap(top_corr_value_arr.begin(), top_corr_value_arr.end(), std::greater<float>{});
+                    }
+                    else if (corr_value > top_corr_value_arr.front()) {
+                        std::pop_heap(top_corr_value_arr.begin(), top_corr_value_arr.end(), std::greater<float>{});
+                        top_corr_value_arr.back() = corr_value;
+                        std::push_heap(top_corr_value_arr.begin(), top_corr_value_arr.end(), std::greater<float>{});
+                    }
+                }
+            }
+        }
+    });
+
+    // merge the top correlation values of the workers
+    for (size_t v = 0; v < variant_arr.size(); v++) {
+        std::vector<float> top_corr_value_arr;
+
+        uint64_t max_corr_offset = math::uint64_max;
+        float max_corr_value = 0;
+
+        for (const auto & variant_top_corr_arr : worker_variant_top_corr_arr) {
+            const VariantTopCorr & variant_top_corr = variant_top_corr_arr[v];
+
+            top_corr_value_arr.insert(top_corr_value_arr.end(), variant_top_corr.top_corr_value_arr.begin(), variant_top_corr.top_corr_value_arr.end());
+
+            // the minimal offset of equal maximums
+            if (variant_top_corr.max_corr_value > max_corr_value ||
+                (variant_top_corr.max_corr_value == max_corr_value && variant_top_corr.max_corr_offset < max_corr_offset)) {
+                max_corr_value = variant_top_corr.max_corr_value;
+                max_corr_offset = variant_top_corr.max_corr_offset;
+            }
+        }
+
+        const size_t num_top_corr_values = (std::min)(top_corr_value_arr.size(), size_t(data.num_top_corr_values));
+
+        std::partial_sort(top_corr_value_arr.begin(), top_corr_value_arr.begin() + num_top_corr_values, top_corr_value_arr.end(), std::greater<float>{});
+
+        double top_corr_sum = 0;
+
+        for (size_t i = 0; i < num_top_corr_values; i++) {
+            top_corr_sum += top_corr_value_arr[i];
+        }
+
+        data.remap_variant_arr.push_back(SyncRemapVariant{
+            variant_arr[v].first,
+            variant_arr[v].second,
+            remapped_syncseq_arr[remap_index_arr[variant_arr[v].second]],
+            max_corr_offset,
+            max_corr_value,
+            num_top_corr_values ? float(top_corr_sum / num_top_corr_values) : 0
+        });
+    }
+
+    std::stable_sort(data.remap_variant_arr.begin(), data.remap_variant_arr.end(), [](const SyncRemapVariant & l, const SyncRemapVariant & r) -> bool {
+        return l.top_corr_mean > r.top_corr_mean || (l.top_corr_mean == r.top_corr_mean && l.max_corr_value > r.max_corr_value);
+    });
+}
+
+// Generates each variant of the `Mode_Gen` mode into the buffer of a thread from the whole input in the buffer and searches the synchro sequence in
+// the variant. The variants are distributed between the threads. The identity variant is included as the first variant.
+//
+// In case of `Mode_Sync_Remap` mode the variants are ranked by the remapped synchro sequence at first and only the best ranked variants are generated.
+//
+// Buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
+//
+void generate_sync_stream(GenSyncData & data, tackle::file_reader_state & state, uint8_t * buf, uint64_t size)
+{
+    data.result_arr.clear();
+
+    // first time read size must be greater than 32 bits
+    //
+    if (!state.read_index && 32 >= size) {
+        return;
+    }
+
+    // single read only
+    state.break_ = true;
+
+    const uint64_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+
+    // zeroing padding bytes
+    for (uint64_t i = size; i < padded_stream_byte_size; i++) {
+        buf[i] = 0;
+    }
+
+    // the noise is generated once for all the variants
+    if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
+        StreamParams stream_params{ data.stream_params };
+        NoiseParams noise_params{ data.noise_params };
+        generate_noise(data.basic_data, stream_params, noise_params, buf, size); // CAUTION: params copy must be copied!
+    }
+
+    // tee preprocessed input
+    if (data.basic_data.tee_file_in_handle.get()) {
+        const size_t write_size = fwrite(buf, 1, size_t(size), data.basic_data.tee_file_in_handle.get());
+        const int file_write_err = ferror(data.basic_data.tee_file_in_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+#ifdef _UNICODE
+            throw std::system_error{ file_write_err, std::system_category(), utility::convert_string_to_string(data.basic_data.tee_file_in_handle.path(), utility::tag_string{}, utility::int_identity<utility::StringConv_utf16_to_utf8>{}) };
+#else
+            throw std::system_error{ file_write_err, std::system_category(), data.basic_data.tee_file_in_handle.path() };
+#endif
+        }
+    }
+
+    // variants in the `Mode_Gen` order: bit shift, baud alphabet sequence index
+    std::vector<std::pair<uint32_t, uint32_t> > variant_arr;
+
+    const uint32_t bits_per_baud = data.basic_data.options_ptr->bits_per_baud;
+    const uint32_t num_baud_alphabet_sequences = uint32_t(data.baud_alphabet_sequences->size());
+
+    for (uint32_t j = 0; j < bits_per_baud; j++) {
+        if (data.gen_bit_shift != math::uint32_max && data.gen_bit_shift != j) {
+            continue;
+        }
+
+        // the identity variant does not depend on the bit shift
+        for (uint32_t i = j ? 1 : 0; i < num_baud_alphabet_sequences; i++) {
+            if (data.gen_combination_variant != math::uint32_max && data.gen_combination_variant != i) {
+                continue;
+            }
+
+            variant_arr.push_back(std::make_pair(j, i));
+        }
+    }
+
+    if (data.basic_data.mode == Mode_Sync_Remap) {
+        rank_remap_variants(data, buf, uint64_t(size) * 8, variant_arr);
+
+        variant_arr.clear();
+
+        const size_t num_remap_sync_variants = (std::min)(data.remap_variant_arr.size(), size_t(data.basic_data.options_ptr->remap_sync_variants));
+
+        for (size_t i = 0; i < num_remap_sync_variants; i++) {
+            const SyncRemapVariant & remap_variant = data.remap_variant_arr[i];
+
+            variant_arr.push_back(std::make_pair(remap_variant.shifted_bit_offset, remap_variant.baud_alphabet_sequence_index));
+        }
+    }
+
+    // the variants are calculated in parallel, so each variant is calculated by a single thread
+    if (variant_arr.size() > 1) {
+        data.corr_in_params.num_threads = 1;
+    }
+
+    WorkStealingPool pool{ variant_arr.size() > 1 ? data.basic_data.options_ptr->num_threads : 1 };
+
+    const std::vector<std::unique_ptr<WorkStealingPool> > worker_pool_arr = make_worker_pools(pool, data.corr_in_params.num_threads);
+
+    std::vector<std::vector<uint8_t> > variant_buf_arr(pool.num_workers());
+
+    struct VariantCalcResult
+    {
+        GenSyncResult               gen_sync_result;
+        CorrOutParams               corr_out_params;
+    };
+
+    const auto calc_func = [&](size_t worker_index, uint64_t variant_index, VariantCalcResult & result) {
+        const uint32_t shifted_bit_offset = variant_arr[size_t(variant_index)].first;
+        const uint32_t baud_alphabet_sequence_index = variant_arr[size_t(variant_index)].second;
+
+        std::vector<uint8_t> & variant_buf = variant_buf_arr[worker_index];
+
+        // The bits out of the translated bauds are copied from the input. The copy does include the zero padding.
+        //
+        variant_buf.assign(buf, buf + size_t(padded_stream_byte_size));
+
+        GenData gen_data{
+            data.basic_data,
+            data.baud_alphabet_start_sequence,
+            &(*data.baud_alphabet_sequences)[baud_alphabet_sequence_index],
+            data.baud_mask,
+            data.baud_capacity,
+            shifted_bit_offset,
+            StreamParams{ padded_stream_byte_size, 0, 0 },
+            NoiseParams{},
+            {},
+            {}
+        };
+
+        translate_bauds(gen_data, buf, variant_buf.data(), uint64_t(size) * 8);
+
+        // the last bauds can be translated into the padding
+        for (size_t i = size_t(size); i < variant_buf.size(); i++) {
+            variant_buf[i] = 0;
+        }
+
+        SyncData sync_data{
+            data.basic_data,
+            math::uint64_max,
+            StreamParams{ padded_stream_byte_size, 0, 0 },
+            NoiseParams{},
+            data.corr_in_params,
+            data.corr_io_params,
+            CorrOutParams{},
+            math::uint64_max,
+            math::uint32_max,
+            false,
+            {}
+        };
+
+        calculate_synchro_sequence(*worker_pool_arr[worker_index], sync_data, variant_buf.data());
+
+        GenSyncResult & gen_sync_result = result.gen_sync_result;
+
+        gen_sync_result.shifted_bit_offset = shifted_bit_offset;
+        gen_sync_result.baud_alphabet_sequence_index = baud_alphabet_sequence_index;
+        gen_sync_result.syncseq_bit_offset = sync_data.syncseq_bit_offset;
+        gen_sync_result.stream_width = sync_data.stream_params.stream_width;
+        gen_sync_result.corr_mean = sync_data.corr_out_params.accum_corr_mean_calc ? sync_data.corr_out_params.used_corr_mean : math::float_max;
+        gen_sync_result.input_inconsistency = sync_data.corr_out_params.input_inconsistency;
+        gen_sync_result.uncertain = sync_data.corr_out_params.accum_corr_mean_quit;
+        gen_sync_result.disagreement = sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean && !sync_data.ensemble_agreement;
+
+        result.corr_out_params = std::move(sync_data.corr_out_params);
+    };
+
+    const auto merge_func = [&](uint64_t variant_index, VariantCalcResult & result) -> bool {
+        const CorrOutParams & corr_out_params = result.corr_out_params;
+
+        // the period range of the first variant, the correlation value range and the counters of all variants
+        if (!variant_index) {
+            data.corr_out_params = corr_out_params;
+        }
+        else {
+            data.corr_out_params.min_corr_value = (std::min)(data.corr_out_params.min_corr_value, corr_out_params.min_corr_value);
+            data.corr_out_params.max_corr_value = (std::max)(data.corr_out_params.max_corr_value, corr_out_params.max_corr_value);
+            data.corr_out_params.num_corr_values_calc += corr_out_params.num_corr_values_calc;
+            data.corr_out_params.num_corr_values_iterated += corr_out_params.num_corr_values_iterated;
+            data.corr_out_params.input_inconsistency |= corr_out_params.input_inconsistency;
+        }
+
+        data.result_arr.push_back(result.gen_sync_result);
+
+        return true;
+    };
+
+    pool.run_ordered<VariantCalcResult>(variant_arr.size(), calc_func, merge_func);
+
+    // The found variants are ranked by the correlation mean value, where the variants without the correlation mean value are ranked after them.
+    // The stable sort does keep the variants order for equal values.
+    //
+    std::stable_sort(data.result_arr.begin(), data.result_arr.end(), [](const GenSyncResult & l, const GenSyncResult & r) -> bool {
+        const bool is_l_found = l.syncseq_bit_offset != math::uint64_max && l.stream_width != math::uint32_max;
+        const bool is_r_found = r.syncseq_bit_offset != math::uint64_max && r.stream_width != math::uint32_max;
+
+        if (is_l_found != is_r_found) {
+            return is_l_found;
+        }
+
+        if ((l.corr_mean != math::float_max) != (r.corr_mean != math::float_max)) {
+            return l.corr_mean != math::float_max;
+        }
+
+        return l.corr_mean != math::float_max && l.corr_mean > r.corr_mean;
+    });
+}
+
+// Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+//
+void search_synchro_sequence_stream(SyncStreamData & data, uint8_t * buf, uint32_t size)
+{
+    // Buffer is already padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+    //
+    const uint64_t padded_stream_byte_size = data.stream_params.padded_stream_byte_size;
+
+    // zeroing padding bytes
+    for (uint64_t i = size; i < padded_stream_byte_size; i++) {
+        buf[i] = 0;
+    }
+
+    // the noise is continued between chunks as in the pipe mode
+    if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
+        generate_noise(data.basic_data, data.stream_params, data.noise_params, buf, size);
+    }
+
+    // tee preprocessed input
+    if (data.basic_data.tee_file_in_handle.get()) {
+        const size_t write_size = fwrite(buf, 1, size, data.basic_data.tee_file_in_handle.get());
+        const int file_write_err = ferror(data.basic_data.tee_file_in_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+#ifdef _UNICODE
+            throw std::system_error{ file_write_err, std::system_category(), utility::convert_string_to_string(data.basic_data.tee_file_in_handle.path(), utility::tag_string{}, utility::int_identity<utility::StringConv_utf16_to_utf8>{}) };
+#else
+            throw std::system_error{ file_write_err, std::system_category(), data.basic_data.tee_file_in_handle.path() };
+#endif
+        }
+    }
+
+    if (!data.stream_sync_tracker_ptr->push_bytes(buf, size, data.corr_out_params)) {
+        return;
+    }
+
+    data.num_lock_changes++;
+
+    const StreamSyncLock & lock = data.stream_sync_tracker_ptr->lock();
+
+    // a record per lock change, where not locked state is printed as `-`
+    fmt::print(
+        _T("stream bit {:d}: offset/period/confidence: {:s} / {:s} / {:s}\n"),
+        lock.stream_bit_size,
+        lock.period ? std::to_tstring(lock.offset) : _T("-"),
+        lock.period ? std::to_tstring(lock.period) : _T("-"),
+        lock.period ? fmt::format(_T("{:#06f}"), lock.corr_mean) : _T("-"));
+
+    // the output can be read by another process while the input is still being read
+    fflush(stdout);
+}
+
+// Splits the input into the windows overlapped by `overlap_byte_size` and searches the synchro sequence in each window independently by a pool of
+// threads, where each thread reads a window into its own buffer. The results are printed as a timeline in the window order.
+//
+//  Memory complexity:   O(W * T), where W - window bit length, T - number of threads
+//
+void search_synchro_sequence_windows(SyncWindowData & data, FILE * file_in)
+{
+    const uint64_t window_step_byte_size = data.window_byte_size - data.overlap_byte_size;
+
+    data.num_windows = data.input_byte_size > data.window_byte_size ?
+        (data.input_byte_size - data.window_byte_size + window_step_byte_size - 1) / window_step_byte_size + 1 :
+        1;
+    data.num_locked_windows = 0;
+    data.num_period_changes = 0;
+    data.max_abs_drift = 0;
+
+    // the windows are calculated in parallel, so each window is calculated by a single thread
+    if (data.num_windows > 1) {
+        data.corr_in_params.num_threads = 1;
+    }
+
+    WorkStealingPool pool{ data.num_windows > 1 ? data.basic_data.options_ptr->num_threads : 1 };
+
+    const std::vector<std::unique_ptr<WorkStealingPool> > worker_pool_arr = make_worker_pools(pool, data.corr_in_params.num_threads);
+
+    std::vector<std::vector<uint8_t> > window_buf_arr(pool.num_workers());
+
+    std::mutex read_mutex;
+
+    struct WindowCalcResult
+    {
+        SyncWindowResult            window_result;
+        CorrOutParams               corr_out_params;
+    };
+
+    SyncWindowResult prev_window_result{};
+
+    prev_window_result.syncseq_bit_offset = math::uint64_max;
+
+    const auto calc_func = [&](size_t worker_index, uint64_t window_index, WindowCalcResult & result) {
+        // the last window is aligned to the end of the input to be not shorter than the others
+        const size_t window_byte_size = size_t((std::min)(uint64_t(data.window_byte_size), data.input_byte_size));
+        const uint64_t window_byte_offset = (std::min)(window_index * window_step_byte_size, data.input_byte_size - window_byte_size);
+
+        std::vector<uint8_t> & window_buf = window_buf_arr[worker_index];
+
+        // allocated once per thread
+        window_buf.resize(size_t(data.stream_params.padded_stream_byte_size));
+
+        SyncData sync_data{
+            data.basic_data,
+            math::uint64_max,
+            StreamParams{ data.stream_params.padded_stream_byte_size, window_byte_offset * 8, 0 },
+            NoiseParams{},
+            data.corr_in_params,
+            data.corr_io_params,
+            CorrOutParams{},
+            math::uint64_max,
+            math::uint32_max,
+            false,
+            {}
+        };
+
+        sync_data.corr_in_params.stream_bit_size = uint64_t(window_byte_size) * 8;
+
+        {
+            std::lock_guard<std::mutex> lock{ read_mutex };
+
+            if (_fseeki64(file_in, int64_t(window_byte_offset), SEEK_SET)) {
+                throw std::runtime_error(fmt::format("input seek error: offset={:d}", window_byte_offset));
+            }
+
+            const size_t read_size = fread(window_buf.data(), 1, window_byte_size, file_in);
+            if (read_size < window_byte_size) {
+                throw std::runtime_error(fmt::format("input read error: offset={:d} size={:d} error={:d}", window_byte_offset, window_byte_size, ferror(file_in)));
+            }
+
+            // the noise is generated by the absolute stream offset of the window, the generator is not thread safe
+            if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
+                generate_noise(data.basic_data, sync_data.stream_params, sync_data.noise_params, window_buf.data(), window_byte_size);
+            }
+        }
+
+        // zeroing padding bytes
+        for (size_t i = window_byte_size; i < window_buf.size(); i++) {
+            window_buf[i] = 0;
+        }
+
+        calculate_synchro_sequence(*worker_pool_arr[worker_index], sync_data, window_buf.data());
+
+        SyncWindowResult & window_result = result.window_result;
+
+        window_result.window_bit_offset = window_byte_offset * 8;
+        window_result.window_bit_size = uint64_t(window_byte_size) * 8;
+        window_result.syncseq_bit_offset = sync_data.syncseq_bit_offset != math::uint64_max ?
+            window_result.window_bit_offset + sync_data.syncseq_bit_offset : math::uint64_max;
+        window_result.stream_width = sync_data.stream_params.stream_width;
+        window_result.corr_mean = sync_data.corr_out_params.accum_corr_mean_calc ? sync_data.corr_out_params.used_corr_mean : math::float_max;
+        window_result.input_inconsistency = sync_data.corr_out_params.input_inconsistency;
+        window_result.uncertain = sync_data.corr_out_params.accum_corr_mean_quit;
+        window_result.disagreement = sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean && !sync_data.ensemble_agreement;
+
+        result.corr_out_params = std::move(sync_data.corr_out_params);
+    };
+
+    const auto merge_func = [&](uint64_t window_index, WindowCalcResult & result) -> bool {
+        const SyncWindowResult & window_result = result.window_result;
+        const CorrOutParams & corr_out_params = result.corr_out_params;
+
+        const bool is_locked = window_result.syncseq_bit_offset != math::uint64_max && window_result.stream_width != math::uint32_max;
+        const bool is_prev_locked = prev_window_result.syncseq_bit_offset != math::uint64_max && prev_window_result.stream_width != math::uint32_max;
+
+        // the period range of the first window, the correlation value range and the counters of all windows
+        if (!window_index) {
+            data.corr_out_params = corr_out_params;
+        }
+        else {
+            data.corr_out_params.min_corr_value = (std::min)(data.corr_out_params.min_corr_value, corr_out_params.min_corr_value);
+            data.corr_out_params.max_corr_value = (std::max)(data.corr_out_params.max_corr_value, corr_out_params.max_corr_value);
+            data.corr_out_params.num_corr_values_calc += corr_out_params.num_corr_values_calc;
+            data.corr_out_params.num_corr_values_iterated += corr_out_params.num_corr_values_iterated;
+            data.corr_out_params.input_inconsistency |= corr_out_params.input_inconsistency;
+        }
+
+        std::tstring drift_str{ _T("-") };
+        std::tstring suffix_msg_str;
+
+        if (is_locked) {
+            data.num_locked_windows++;
+
+            if (is_prev_locked) {
+                if (window_result.stream_width != prev_window_result.stream_width) {
+                    data.num_period_changes++;
+                    suffix_msg_str += _T(" [PERIOD CHANGE]");
+                }
+                else {
+                    // the offset difference by the modulo of the period in range [-period/2; +period/2)
+                    const uint32_t period = window_result.stream_width;
+                    const uint64_t remainder = (window_result.syncseq_bit_offset + period - prev_window_result.syncseq_bit_offset % period) % period;
+                    const int64_t drift = remainder < (period + 1) / 2 ? int64_t(remainder) : int64_t(remainder) - int64_t(period);
+                    const uint64_t abs_drift = uint64_t(drift >= 0 ? drift : -drift);
+
+                    if (data.max_abs_drift < abs_drift) {
+                        data.max_abs_drift = abs_drift;
+                    }
+
+                    drift_str = fmt::format(_T("{:+d}"), drift);
+                }
+            }
+        }
+
+        if (window_result.input_inconsistency) {
+            suffix_msg_str += _T(" [INPUT INCONSISTENCY]");
+        }
+        if (window_result.uncertain) {
+            suffix_msg_str += _T(" [UNCERTAIN]");
+        }
+        if (window_result.disagreement) {
+            suffix_msg_str += _T(" [DISAGREEMENT]");
+        }
+
+        // a record per window, where not found values are printed as `-`
+        fmt::print(
+            _T("window {:d} bit {:d}-{:d}: offset/period/corr mean/drift: {:s} / {:s} / {:s} / {:s}{:s}\n"),
+            window_index,
+            window_result.window_bit_offset,
+            window_result.window_bit_offset + window_result.window_bit_size,
+            is_locked ? std::to_tstring(window_result.syncseq_bit_offset) : _T("-"),
+            is_locked ? std::to_tstring(window_result.stream_width) : _T("-"),
+            is_locked && window_result.corr_mean != math::float_max ? fmt::format(_T("{:#06f}"), window_result.corr_mean) : _T("-"),
+            drift_str,
+            suffix_msg_str);
+
+        // the output can be read by another process while the input is still being read
+        fflush(stdout);
+
+        prev_window_result = window_result;
+
+        return true;
+    };
+
+    pool.run_ordered<WindowCalcResult>(data.num_windows, calc_func, merge_func);
+}
+
+// Searches the synchro sequence in each input file independently by a pool of threads, where each thread reads an input file into its own buffer
+// reused between the input files. The results are printed in the input files order.
+//
+void search_synchro_sequence_batch(SyncBatchData & data)
+{
+    const std::vector<tackle::path_tstring> & input_file_arr = *data.input_file_arr_ptr;
+
+    const uint64_t max_stream_byte_size = data.basic_data.options_ptr->stream_byte_size; // 0 - whole input file
+
+    data.num_locked_files = 0;
+    data.num_failed_files = 0;
+
+    // the input files are calculated in parallel, so each input file is calculated by a single thread
+    if (input_file_arr.size() > 1) {
+        data.corr_in_params.num_threads = 1;
+    }
+
+    WorkStealingPool pool{ input_file_arr.size() > 1 ? data.basic_data.options_ptr->num_threads : 1 };
+
+    const std::vector<std::unique_ptr<WorkStealingPool> > worker_pool_arr = make_worker_pools(pool, data.corr_in_params.num_threads);
+
+    std::vector<std::vector<uint8_t> > stream_buf_arr(pool.num_workers());
+
+    std::mutex noise_mutex;
+
+    struct BatchCalcResult
+    {
+        SyncBatchResult             batch_result;
+        CorrOutParams               corr_out_params;
+    };
+
+    const auto calc_func = [&](size_t worker_index, uint64_t file_index, BatchCalcResult & result) {
+        SyncBatchResult & batch_result = result.batch_result;
+
+        batch_result.syncseq_bit_offset = math::uint64_max;
+        batch_result.stream_width = math::uint32_max;
+        batch_result.corr_mean = math::float_max;
+
+        try {
+            const tackle::file_handle<TCHAR> file_in_handle =
+                utility::open_file(input_file_arr[size_t(file_index)], IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, _T("rb"), utility::SharedAccess_DenyWrite);
+
+            const uint64_t file_byte_size = utility::get_file_size(file_in_handle);
+            const uint64_t stream_byte_size = max_stream_byte_size && max_stream_byte_size < file_byte_size ? max_stream_byte_size : file_byte_size;
+
+            // first time read size must be greater than 32 bits
+            if (stream_byte_size <= 4) {
+                throw std::runtime_error(fmt::format("input file is too short: size={:d}", stream_byte_size));
+            }
+
+            if (stream_byte_size >= math::size_max / 8) {
+                throw std::runtime_error(fmt::format("input file is too big: size={:d}", stream_byte_size));
+            }
+
+            // Buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
+            // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+            //
+            const uint64_t padded_stream_byte_size = ((stream_byte_size + 3) & ~uint64_t(3)) + 4;
+
+            std::vector<uint8_t> & stream_buf = stream_buf_arr[worker_index];
+
+            // reallocated only by a greater input file
+            if (stream_buf.size() < padded_stream_byte_size) {
+                stream_buf.resize(size_t(padded_stream_byte_size));
+            }
+
+            const size_t read_size = fread(stream_buf.data(), 1, size_t(stream_byte_size), file_in_handle.get());
+            if (read_size < stream_byte_size) {
+                throw std::runtime_error(fmt::format("input file read error: size={:d} error={:d}", stream_byte_size, ferror(file_in_handle.get())));
+            }
+
+            // zeroing padding bytes
+            for (size_t i = size_t(stream_byte_size); i < size_t(padded_stream_byte_size); i++) {
+                stream_buf[i] = 0;
+            }
+
+            SyncData sync_data{
+                data.basic_data,
+                math::uint64_max,
+                StreamParams{ padded_stream_byte_size, 0, 0 },
+                NoiseParams{},
+                data.corr_in_params,
+                data.corr_io_params,
+                CorrOutParams{},
+                math::uint64_max,
+                math::uint32_max,
+                false,
+                {}
+            };
+
+            sync_data.corr_in_params.stream_bit_size = stream_byte_size * 8;
+
+            // the noise generator is not thread safe
+            if (data.basic_data.options_ptr->gen_input_noise_bit_block_size) {
+                std::lock_guard<std::mutex> lock{ noise_mutex };
+
+                generate_noise(data.basic_data, sync_data.stream_params, sync_data.noise_params, stream_buf.data(), stream_byte_size);
+            }
+
+            calculate_synchro_sequence(*worker_pool_arr[worker_index], sync_data, stream_buf.data());
+
+            batch_result.stream_bit_size = sync_data.corr_in_params.stream_bit_size;
+            batch_result.syncseq_bit_offset = sync_data.syncseq_bit_offset;
+            batch_result.stream_width = sync_data.stream_params.stream_width;
+            batch_result.corr_mean = sync_data.corr_out_params.accum_corr_mean_calc ? sync_data.corr_out_params.used_corr_mean : math::float_max;
+            batch_result.input_inconsistency = sync_data.corr_out_params.input_inconsistency;
+            batch_result.uncertain = sync_data.corr_out_params.accum_corr_mean_quit;
+            batch_result.disagreement = sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean && !sync_data.ensemble_agreement;
+
+            result.corr_out_params = std::move(sync_data.corr_out_params);
+        }
+        catch (const std::exception & ex) {
+            // the rest input files are processed
+            batch_result.error_msg = ex.what();
+        }
+    };
+
+    bool is_first_processed = true;
+
+    const auto merge_func = [&](uint64_t file_index, BatchCalcResult & result) -> bool {
+        const SyncBatchResult & batch_result = result.batch_result;
+        const CorrOutParams & corr_out_params = result.corr_out_params;
+
+        const tackle::path_tstring & input_file = input_file_arr[size_t(file_index)];
+
+        if (!batch_result.error_msg.empty()) {
+            data.num_failed_files++;
+
+            _ftprintf(stderr, _T("error: %s: %hs\n"), input_file.c_str(), batch_result.error_msg.c_str());
+
+            // a record per input file, where the failed input file is printed as not found
+            fmt::print(_T("{:s}: offset/period/corr mean: - / - / - [ERROR]\n"), input_file.str());
+            fflush(stdout);
+
+            return true;
+        }
+
+        // the period range of the first processed input file, the correlation value range and the counters of all input files
+        if (is_first_processed) {
+            data.corr_out_params = corr_out_params;
+            is_first_processed = false;
+        }
+        else {
+            data.corr_out_params.min_corr_value = (std::min)(data.corr_out_params.min_corr_value, corr_out_params.min_corr_value);
+            data.corr_out_params.max_corr_value = (std::max)(data.corr_out_params.max_corr_value, corr_out_params.max_corr_value);
+            data.corr_out_params.num_corr_values_calc += corr_out_params.num_corr_values_calc;
+            data.corr_out_params.num_corr_values_iterated += corr_out_params.num_corr_values_iterated;
+            data.corr_out_params.input_inconsistency |= corr_out_params.input_inconsistency;
+        }
+
+        const bool is_locked = batch_result.syncseq_bit_offset != math::uint64_max && batch_result.stream_width != math::uint32_max;
+
+        if (is_locked) {
+            data.num_locked_files++;
+        }
+
+        std::tstring suffix_msg_str;
+
+        if (batch_result.input_inconsistency) {
+            suffix_msg_str += _T(" [INPUT INCONSISTENCY]");
+        }
+        if (batch_result.uncertain) {
+            suffix_msg_str += _T(" [UNCERTAIN]");
+        }
+        if (batch_result.disagreement) {
+            suffix_msg_str += _T(" [DISAGREEMENT]");
+        }
+
+        // a record per input file, where not found values are printed as `-`
+        fmt::print(
+            _T("{:s}: offset/period/corr mean: {:s} / {:s} / {:s}{:s}\n"),
+            input_file.str(),
+            is_locked ? std::to_tstring(batch_result.syncseq_bit_offset) : _T("-"),
+            is_locked ? std::to_tstring(batch_result.stream_width) : _T("-"),
+            is_locked && batch_result.corr_mean != math::float_max ? fmt::format(_T("{:#06f}"), batch_result.corr_mean) : _T("-"),
+            suffix_msg_str);
+
+        // the output can be read by another process while the rest input files are still being processed
+        fflush(stdout);
+
+        return true;
+    };
+
+    pool.run_ordered<BatchCalcResult>(input_file_arr.size(), calc_func, merge_func);
+}
+
+void read_file_chunk(uint8_t * buf, uint64_t size, void * user_data, tackle::file_reader_state & state)
+{
+    if (sizeof(size_t) < sizeof(uint64_t)) {
+        const uint64_t max_value = uint64_t(math::size_max);
+        if (size > max_value) {
+            throw std::runtime_error(fmt::format("size is out of buffer: size={:d}", size));
+        }
+    }
+
+    ReadFileChunkData & read_file_chunk_data = *static_cast<ReadFileChunkData *>(user_data);
+
+    switch (read_file_chunk_data.mode)
+    {
+    case Mode_Gen:
+    {
+        GenVariantsData & data = *static_cast<GenVariantsData *>(read_file_chunk_data.mode_data);
+
+        const size_t read_size = uint32_t(size);
+
+        generate_variant_streams(data, state, buf, read_size);
+    } break;
+
+    case Mode_Sync:
+    {
+        SyncData & data = *static_cast<SyncData *>(read_file_chunk_data.mode_data);
+
+        // the stream is not limited by 4GB
+        const size_t read_size = size_t(size);
+
+        search_synchro_sequence(data, state, buf, read_size);
+    } break;
+
+    case Mode_Gen_Sync:
+    case Mode_Sync_Remap:
+    {
+        GenSyncData & data = *static_cast<GenSyncData *>(read_file_chunk_data.mode_data);
+
+        const size_t read_size = uint32_t(size);
+
+        generate_sync_stream(data, state, buf, read_size);
+    } break;
+
+    case Mode_Pipe:
+    {
+        PipeData & data = *static_cast<PipeData *>(read_file_chunk_data.mode_data);
+
+        const size_t read_size = uint32_t(size);
+
+        pipe_stream(data, state, buf, read_size);
+    } break;
+
+    // the rest of the modes do not read the input by chunks
+    default:
+    {
+        assert(0); // not implemented
     } break;
     }
 }
@@ -3,6 +3,8 @@
 #include "common.hpp"
 
 #include "correlation.hpp"
+#include "correlation_simd.hpp"
+#include "stream_sync.hpp"
 
 #include "tacklelib/utility/utility.hpp"
 #include "tacklelib/utility/assert.hpp"
@@ -18,11 +20,16 @@
 #include <string>
 #include <iostream>
 #include <vector>
+#include <memory>
 
 #include <stdio.h>
 #include <stdlib.h>
 
 
+#define DEFAULT_REMAP_SYNC_VARIANTS 1
+#define MAX_NUM_THREADS 1024
+
+
 namespace tackle {
 #ifdef _UNICODE
     using path_tstring              = path_wstring;
@@ -56,6 +63,7 @@ struct Flags
     bool no_zero_corr;
     bool use_linear_corr;
     bool skip_calc_on_filtered_corr_value_use;
+    bool use_comb_corr_sum;
     bool skip_max_weighted_sum_of_corr_mean_calc;
     bool sort_at_first_by_max_corr_mean;
     bool return_sorted_result;
@@ -78,15 +86,22 @@ struct Options
     Impl::impl_token        impl_token;
     std::tstring            corr_mm_token_str;
     Impl::corr_multiply_method  corr_mm;
+    std::tstring            simd_token_str;
+    Impl::simd_token        simd_token;
+    std::tstring            corr_value_token_str;
+    Impl::corr_value_token  corr_value_token;
     std::tstring            mode;
-    uint32_t                stream_byte_size;
+    uint64_t                stream_byte_size;
     uint64_t                stream_bit_size;
+    uint32_t                stream_chunk_byte_size;
     uint32_t                stream_min_period;
     uint32_t                stream_max_period;
     uint32_t                max_periods_in_offset;              // -1 = no limit, 0 = 1 period excluding first bit of 2d period, 1 = 1 period including first bit of 2d period, >1 = N periods including first bit of N+1 period
     uint32_t                max_corr_values_per_period;
     uint32_t                syncseq_bit_size;
     uint32_t                syncseq_int32;
+    std::vector<uint32_t>   syncseq_bit_size_arr;               // the first is `syncseq_bit_size`, a single value - for all synchro sequences
+    std::vector<uint32_t>   syncseq_int32_arr;                  // the first is `syncseq_int32`, multiple synchro sequences are searched in the sync mode only
     uint32_t                syncseq_min_repeat;
     uint32_t                syncseq_max_repeat;
     uint32_t                bits_per_baud;
@@ -99,8 +114,15 @@ struct Options
     uint32_t                insert_output_syncseq_period_repeat;
     float                   corr_min;
     float                   corr_mean_min;
+    uint32_t                track_drift_bit_size;
+    uint32_t                track_max_misses;
+    float                   track_corr_min;
     uint64_t                corr_mean_buf_max_size_mb;
+    uint32_t                num_threads;                        // 0 = number of the processor hardware threads
+    uint32_t                autocorr_fft_min_size;
+    uint32_t                remap_sync_variants;                // number of the best ranked variants to synchronize in the remap mode, 0 - no synchronization
     tackle::path_tstring    input_file;
+    std::vector<tackle::path_tstring> input_file_arr;           // input files of the batch mode
     tackle::path_tstring    tee_input_file;
     tackle::path_tstring    output_file_dir;
     tackle::path_tstring    output_file;
@@ -109,6 +131,8 @@ struct Options
 
     void update_impl_token_defaults();
     void update_corr_mm_defaults();
+    void update_simd_token_defaults();
+    void update_corr_value_token_defaults();
     void update_corr_min_defaults(const Flags & flags);
 };
 
@@ -117,8 +141,13 @@ enum Mode
     Mode_None           = 0,
     Mode_Gen            = 1,
     Mode_Sync           = 2,
-    Mode_Gen_Sync       = 3,    // TODO: generate into memory instead of into files and sync with each generated file
+    Mode_Gen_Sync       = 3,    // `Mode_Sync` of each `Mode_Gen` variant generated into memory in parallel
     Mode_Pipe           = 4,
+    Mode_Sync_Stream    = 5,
+    Mode_Sync_Track     = 6,    // `Mode_Sync_Stream` with the lock tracking after the lock acquisition
+    Mode_Sync_Window    = 7,    // `Mode_Sync` of each overlapped window of the input in parallel
+    Mode_Sync_Batch     = 8,    // `Mode_Sync` of each input file in parallel
+    Mode_Sync_Remap     = 9,    // `Mode_Gen_Sync` of the best variants ranked by the remapped synchro sequence correlation values in the input
 };
 
 struct BasicData
@@ -131,7 +160,7 @@ struct BasicData
 
 struct StreamParams
 {
-    uint32_t                        padded_stream_byte_size;
+    uint64_t                        padded_stream_byte_size;
     uint64_t                        last_bit_offset;
     uint32_t                        stream_width;
 };
@@ -153,6 +182,34 @@ struct GenData
     StreamParams                    stream_params;
     NoiseParams                     noise_params;
     tackle::file_handle<TCHAR>      file_out_handle;
+    std::vector<uint8_t>            write_buf;              // output buffer reused between the chunks
+};
+
+// Baud remap variants generation by a single read of the input, where the chunk is translated and written into the output file of each variant
+// in parallel.
+//
+struct GenVariantsData
+{
+    BasicData                       basic_data;
+
+    StreamParams                    stream_params;
+    NoiseParams                     noise_params;
+    std::vector<GenData>            variant_data_arr;
+    std::unique_ptr<WorkStealingPool> pool_ptr;
+};
+
+// Synchro sequence search result of a synchro sequence in case of multiple synchro sequences.
+//
+struct SyncPatternResult
+{
+    uint32_t                        syncseq_int32;
+    uint32_t                        syncseq_bit_size;
+    uint64_t                        syncseq_bit_offset;     // `math::uint64_max` - not found
+    uint32_t                        stream_width;           // `math::uint32_max` - not found
+    float                           corr_mean;              // `math::float_max` - not calculated
+    bool                            input_inconsistency;
+    bool                            uncertain;
+    bool                            disagreement;           // in case of the ensemble implementation
 };
 
 struct SyncData
@@ -165,6 +222,139 @@ struct SyncData
     CorrInParams                    corr_in_params;
     CorrInOutParams                 corr_io_params;
     CorrOutParams                   corr_out_params;
+
+    // the result of the minimum sum of correlation mean deviation values in case of the ensemble implementation
+    uint64_t                        ensemble_syncseq_bit_offset;
+    uint32_t                        ensemble_stream_width;
+    bool                            ensemble_agreement;     // both implementations have the same offset and period or both have not found
+
+    // results of each synchro sequence in the options order in case of multiple synchro sequences, where the result of the maximum correlation mean
+    // value is the result of the search
+    std::vector<SyncPatternResult>  pattern_result_arr;
+};
+
+struct SyncStreamData
+{
+    BasicData                       basic_data;
+
+    StreamParams                    stream_params;
+    NoiseParams                     noise_params;
+    CorrInParams                    corr_in_params;
+    CorrInOutParams                 corr_io_params;
+    CorrOutParams                   corr_out_params;
+    StreamTrackParams               track_params;
+    std::unique_ptr<StreamSyncTracker> stream_sync_tracker_ptr;
+    uint64_t                        num_lock_changes;
+};
+
+// Synchro sequence search result of a window.
+//
+struct SyncWindowResult
+{
+    uint64_t                        window_bit_offset;
+    uint64_t                        window_bit_size;
+    uint64_t                        syncseq_bit_offset;     // absolute stream offset, `math::uint64_max` - not found
+    uint32_t                        stream_width;           // `math::uint32_max` - not found
+    float                           corr_mean;              // `math::float_max` - not calculated
+    bool                            input_inconsistency;
+    bool                            uncertain;
+    bool                            disagreement;           // in case of the ensemble implementation
+};
+
+struct SyncWindowData
+{
+    BasicData                       basic_data;
+
+    StreamParams                    stream_params;          // padded window byte size
+    CorrInParams                    corr_in_params;         // window bit size
+    CorrInOutParams                 corr_io_params;
+    CorrOutParams                   corr_out_params;        // of the last window with the period range and the correlation value range of all windows
+
+    uint64_t                        input_byte_size;
+    uint32_t                        window_byte_size;
+    uint32_t                        overlap_byte_size;      // not less than `stream_max_period * syncseq_max_repeat` bits
+
+    uint64_t                        num_windows;
+    uint64_t                        num_locked_windows;
+    uint64_t                        num_period_changes;
+    uint64_t                        max_abs_drift;          // maximal drift of the synchro sequence offset between neighbour windows of the same period
+};
+
+// Synchro sequence search result of an input file of the batch.
+//
+struct SyncBatchResult
+{
+    uint64_t                        stream_bit_size;
+    uint64_t                        syncseq_bit_offset;     // `math::uint64_max` - not found
+    uint32_t                        stream_width;           // `math::uint32_max` - not found
+    float                           corr_mean;              // `math::float_max` - not calculated
+    bool                            input_inconsistency;
+    bool                            uncertain;
+    bool                            disagreement;           // in case of the ensemble implementation
+    std::string                     error_msg;              // not empty if the input file is not processed
+};
+
+struct SyncBatchData
+{
+    BasicData                       basic_data;
+
+    CorrInParams                    corr_in_params;
+    CorrInOutParams                 corr_io_params;
+    CorrOutParams                   corr_out_params;        // of the first input file with the correlation value range of all input files
+
+    const std::vector<tackle::path_tstring> * input_file_arr_ptr;
+
+    uint64_t                        num_locked_files;
+    uint64_t                        num_failed_files;
+};
+
+// Synchro sequence search result of a generated variant.
+//
+struct GenSyncResult
+{
+    uint32_t                        shifted_bit_offset;
+    uint32_t                        baud_alphabet_sequence_index;
+    uint64_t                        syncseq_bit_offset;     // `math::uint64_max` - not found
+    uint32_t                        stream_width;           // `math::uint32_max` - not found
+    float                           corr_mean;              // `math::float_max` - not calculated
+    bool                            input_inconsistency;
+    bool                            uncertain;
+    bool                            disagreement;           // in case of the ensemble implementation
+};
+
+// Correlation values estimation of a variant by the remapped synchro sequence in the not generated stream.
+//
+struct SyncRemapVariant
+{
+    uint32_t                        shifted_bit_offset;
+    uint32_t                        baud_alphabet_sequence_index;
+    uint32_t                        syncseq_int32;          // remapped synchro sequence beginning from a baud, the bits of a partial baud are zero
+    uint64_t                        max_corr_offset;        // stream offset of the correlation maximum value
+    float                           max_corr_value;
+    float                           top_corr_mean;          // mean of the top correlation values
+};
+
+struct GenSyncData
+{
+    BasicData                       basic_data;
+
+    std::vector<uint8_t> *          baud_alphabet_start_sequence;
+    std::vector<std::vector<uint8_t> > * baud_alphabet_sequences;
+    uint32_t                        baud_mask;
+    uint32_t                        baud_capacity;
+    uint32_t                        gen_bit_shift;          // `math::uint32_max` - all
+    uint32_t                        gen_combination_variant;// `math::uint32_max` - all
+    StreamParams                    stream_params;
+    NoiseParams                     noise_params;
+    CorrInParams                    corr_in_params;
+    CorrInOutParams                 corr_io_params;
+    CorrOutParams                   corr_out_params;        // of the first variant with the correlation value range of all variants
+
+    std::vector<GenSyncResult>      result_arr;             // sorted by the correlation mean value from maximum to minimum, not found at the end
+
+    // `Mode_Sync_Remap` only
+    uint32_t                        num_top_corr_values;    // number of the top correlation values of a variant to rank the variants
+    std::vector<SyncRemapVariant>   remap_variant_arr;      // sorted by the mean of the top correlation values from maximum to minimum
 };
 
 struct PipeData
@@ -182,7 +372,11 @@ struct ReadFileChunkData
     void *                          mode_data;
 };
 
-void generate_stream(GenData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size);
+void generate_variant_streams(GenVariantsData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size);
+void generate_sync_stream(GenSyncData & data, tackle::file_reader_state & state, uint8_t * buf, uint64_t size);
 void pipe_stream(PipeData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size);
-void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state, uint8_t * buf, uint32_t size);
+void search_synchro_sequence(SyncData & data, tackle::file_reader_state & state, uint8_t * buf, uint64_t size);
+void search_synchro_sequence_stream(SyncStreamData & data, uint8_t * buf, uint32_t size);
+void search_synchro_sequence_windows(SyncWindowData & data, FILE * file_in);
+void search_synchro_sequence_batch(SyncBatchData & data);
 void read_file_chunk(uint8_t * buf, uint64_t size, void * user_data, tackle::file_reader_state & state);
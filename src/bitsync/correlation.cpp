@@ -2,6 +2,11 @@
 //
 
 #include "correlation.hpp"
+#include "correlation_simd.hpp"
+#include "work_stealing_pool.hpp"
+#include "top_k_heap.hpp"
+#include "radix_sort.hpp"
+#include "fft.hpp"
 
 #include <boost/utility/binary.hpp>
 #include <boost/scope_exit.hpp>
@@ -10,6 +15,7 @@
 #include <tacklelib/utility/preprocessor/if_break.hpp>
 #include <tacklelib/utility/math.hpp>
 
+#include <memory>
 #include <limits>
 #include <cmath>
 #include <chrono>
@@ -329,13 +335,13 @@ inline void calc_phase_time_fractions(double calc_all_time_sec, std::vector<Calc
     }
 }
 
+static const uint32_t s_prime1033_numbers_arr[] = { // CAUTION: for 32-bit blocks
+    1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129,
+    1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259,
+};
+
 extern inline float multiply_bits(Impl::corr_multiply_method mm, uint32_t in0_value, uint32_t in1_value, size_t size)
 {
-    static const uint32_t s_prime1033_numbers_arr[] = { // CAUTION: for 32-bit blocks
-        1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129,
-        1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259,
-    };
-
     assert(size > 0 && 32 >= size);
 
     uint32_t multiplied_value = 0;
@@ -391,1076 +397,1757 @@ extern inline float calculate_corr_value(Impl::corr_multiply_method mm, uint32_t
     return make_linear_corr ? std::sqrt(corr) : corr;
 }
 
-void calculate_syncseq_correlation(
-    const CorrInParams &                    corr_in_params,
-    CorrInOutParams &                       corr_io_params,
-    CorrOutParams &                         corr_out_params,
-    uint8_t *                               stream_buf,
-    std::vector<float> &                    corr_values_arr,
-    std::vector<SyncseqCorr> &              corr_autocorr_arr,
-    std::deque<SyncseqCorrMean> &           corr_max_weighted_mean_sum_deq,
-    std::deque<SyncseqCorrMeanDeviat> &     corr_min_mean_deviat_sum_deq)
+// multiplied value of a single bit pair at the bit position, must be in sync with the `multiply_bits` function
+//
+inline uint32_t multiply_bit(Impl::corr_multiply_method mm, uint32_t in0_bit, uint32_t in1_bit, size_t bit_index)
 {
-    // Old classic xor algorithm:
-    //
-    //  Search synchro sequence in a bit stream by sequential 32-bit blocks compare as shifted 64-bit blocks.
-    //  Formula for all comparisons (K) of N 32-bit blocks in a stream:
-    //    If N-even => K = ((N + 1) * N / 2 - 1) * 32
-    //    If N-odd  => K = ((N + 1) / 2 * N - 1) * 32
-    //
-    // New algorithm does not use xor. Instead it does use 2 functions multiplication to calculate correlation.
-    // The main difference is that the xor algorithm does not resistant to the input noise, when the correlation algorithm can be modified to gain that ability.
-    //
-
-    const auto begin_calc_time = std::chrono::high_resolution_clock::now();
-
-    corr_out_params.calc_time_phases.reserve(4);
-
-    BOOST_SCOPE_EXIT(&corr_out_params, begin_calc_time) {
-        const auto calc_all_time_sec = end_calc_phase_time(_T("all"), begin_calc_time, corr_out_params.calc_time_phases);
+    switch (mm) {
+    case Impl::corr_muliply_inverted_xor_prime1033:
+        return in0_bit == in1_bit ? s_prime1033_numbers_arr[bit_index] : 0;
 
-        calc_phase_time_fractions(calc_all_time_sec, corr_out_params.calc_time_phases);
-    } BOOST_SCOPE_EXIT_END;
+    case Impl::corr_muliply_dispersed_value_prime1033:
+        return (in0_bit ? s_prime1033_numbers_arr[bit_index] : uint32_t(bit_index + 1) * 2) *
+            (in1_bit ? s_prime1033_numbers_arr[bit_index] : uint32_t(bit_index + 1) * 2);
 
-    const auto stream_bit_size = corr_in_params.stream_bit_size;
-    const auto syncseq_bit_size = corr_in_params.syncseq_bit_size;
+    default:
+        assert(0);
+    }
 
-    const auto syncseq_int32 = corr_io_params.syncseq_int32;
-    const uint32_t syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
-    const uint32_t syncseq_bytes = syncseq_int32 & syncseq_mask;
+    return 0;
+}
 
-    // write back
-    corr_io_params.syncseq_int32 = syncseq_bytes;
+void make_corr_multiply_table(Impl::corr_multiply_method mm, uint32_t syncseq_value, size_t size, CorrMultiplyTable & corr_multiply_table)
+{
+    make_corr_multiply_table(mm, syncseq_value, uint32_t(~(~uint64_t(0) << size)), size, corr_multiply_table);
+}
 
-    assert(stream_bit_size);
-    assert(syncseq_bit_size);
-    assert(syncseq_bit_size < stream_bit_size); // must be greater
+void make_corr_multiply_table(Impl::corr_multiply_method mm, uint32_t syncseq_value, uint32_t syncseq_bit_mask, size_t size, CorrMultiplyTable & corr_multiply_table)
+{
+    assert(size > 0 && 32 >= size);
 
-    // Recalculate the maximum repeats from the minimum repeats, because number of minimum repeats has a priority.
+    // NOTE:
+    //  Each bit of a block is multiplied independently, so the multiplied value of a block is a sum of partial multiplied values of the block bytes.
+    //  The bits beyond the size or out of the bit mask are not multiplied and must gain a zero partial value.
+    //  The partial values sum does not overflow, because the maximal dispersed value multiplication of 32 bits is less than 2^26.
     //
-    const auto syncseq_min_repeat = corr_in_params.period_min_repeat ? corr_in_params.period_min_repeat : 1;
-    const auto syncseq_max_repeat = (std::max)(corr_in_params.period_max_repeat, syncseq_min_repeat);
 
-    uint64_t stream_min_period =
-        (std::min)(
-            // If not defined, then minimal "from" period is at least 2 synchro sequence bit length, otherwise - not less than synchro sequence bit length + 1.
-            // But always not greater than a bit stream length - 1.
-            uint64_t(corr_in_params.min_period ? (std::max)(syncseq_bit_size + 1, corr_in_params.min_period) : syncseq_bit_size * 2),
-            stream_bit_size - 1);
-    uint64_t stream_max_period =
-        (std::min)(
-            // If not defined, then minimal "to" period is at least 2 synchro sequence bit length, otherwise - not less than synchro sequence bit length + 1.
-            // But always not greater than a bit stream length - 1.
-            uint64_t(corr_in_params.max_period != math::uint32_max ? (std::max)(syncseq_bit_size + 1, corr_in_params.max_period) : stream_bit_size * 2),
-            stream_bit_size - 1);
+    for (size_t i = 0; i < 4; i++) {
+        for (uint32_t byte_value = 0; byte_value < 256; byte_value++) {
+            uint32_t syncseq_multiplied_value = 0;
+            uint32_t stream_multiplied_value = 0;
 
-    // align maximum period by minimum period
-    stream_max_period = (std::max)(stream_max_period, stream_min_period);
+            for (size_t j = 0; j < 8; j++) {
+                const size_t bit_index = i * 8 + j;
 
-    // Recalculate min/max periods from the minimum repeat, because number of minimum repeats has priority over a period.
-    //
-    const uint64_t stream_max_period_for_min_repeat = (stream_bit_size - 1) / (syncseq_min_repeat ? syncseq_min_repeat : 1);
+                if (bit_index >= size) {
+                    break;
+                }
 
-    stream_min_period = (std::min)(stream_min_period, stream_max_period_for_min_repeat);
-    stream_max_period = (std::min)(stream_max_period, stream_max_period_for_min_repeat);
+                if (!((syncseq_bit_mask >> bit_index) & 0x01)) {
+                    continue;
+                }
 
-    // just in case
-    stream_min_period = (std::min)(stream_min_period, uint64_t(math::uint32_max));
-    stream_max_period = (std::min)(stream_max_period, uint64_t(math::uint32_max));
+                const uint32_t syncseq_bit = (syncseq_value >> bit_index) & 0x01;
+                const uint32_t stream_bit = (byte_value >> j) & 0x01;
 
-    assert(stream_min_period);
+                syncseq_multiplied_value += multiply_bit(mm, syncseq_bit, stream_bit, bit_index);
+                stream_multiplied_value += multiply_bit(mm, stream_bit, stream_bit, bit_index);
+            }
 
-    // CAUTION:
-    //  Input conditions must be initially in consistency between each other and must not decrease the field of search of the result because of mutual inconsistency.
-    //
+            corr_multiply_table.syncseq_arr[i][byte_value] = syncseq_multiplied_value;
+            corr_multiply_table.stream_arr[i][byte_value] = stream_multiplied_value;
+        }
+    }
+}
 
-    // write back for user notification
-    corr_out_params.min_period = uint32_t(stream_min_period);
-    corr_out_params.max_period = uint32_t(stream_max_period);
+// Sums of the correlation values of a storage type, the fixed point values are summed exactly in the integer domain.
+//
+template <typename T>
+struct CorrValueTraits;
 
-    if (corr_in_params.min_period && corr_in_params.min_period != math::uint32_max && corr_in_params.min_period < stream_min_period) {
-        // recalculated minimum period is increased, important input condition is changed and reduced the field of search of the result, quit calculation
-        corr_out_params.input_inconsistency = true;
-        return;
-    }
+template <>
+struct CorrValueTraits<float>
+{
+    using sum_type = float;
+    using comb_sum_type = double;   // to avoid the accumulation of the rounding error by the subtraction
 
-    if (corr_in_params.max_period != math::uint32_max && stream_max_period < corr_in_params.max_period) {
-        // recalculated maximum period is decreased, important input condition is changed and reduced the field of search of the result, quit calculation
-        corr_out_params.input_inconsistency = true;
-        return;
+    static inline float to_float(float value, float)
+    {
+        return value;
     }
 
-    if (corr_in_params.period_min_repeat && stream_max_period * corr_in_params.period_min_repeat >= stream_bit_size) {
-        // recalculated stream bit size is increased, important input condition is changed and reduced the field of search of the result, quit calculation
-        corr_out_params.input_inconsistency = true;
-        return;
+    static inline float to_float(double value, float)
+    {
+        return float(value);
     }
+};
 
-    assert(stream_max_period * syncseq_min_repeat < stream_bit_size);
+template <>
+struct CorrValueTraits<uint16_t>
+{
+    using sum_type = uint64_t;
+    using comb_sum_type = uint64_t;
 
-    if (syncseq_bit_size >= stream_min_period) {
-        // the input conditions are not met, not enough room for calculation
-        corr_out_params.input_inconsistency = true;
-        return;
+    static inline float to_float(uint64_t value, float corr_value_scale)
+    {
+        return float(double(value) / corr_value_scale);
     }
+};
 
-    // Buffer is already padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
-    //
-    const uint64_t padded_stream_bit_size = (stream_bit_size + 31) & ~uint32_t(31);
-    const uint64_t num_stream_32bit_blocks = padded_stream_bit_size / 32;
-    uint32_t * stream_buf32 = (uint32_t *)stream_buf;
+template <>
+struct CorrValueTraits<uint8_t>
+{
+    using sum_type = uint64_t;
+    using comb_sum_type = uint64_t;
 
-    float syncseq_corr_absmax;
-    std::vector<float> stream_corr_absmax_arr(size_t(stream_bit_size), 1);
+    static inline float to_float(uint64_t value, float corr_value_scale)
+    {
+        return float(double(value) / corr_value_scale);
+    }
+};
 
-    // Phase 1:
-    //
-    //  Correlation values calculation, creates a moderate but still instable algorithm certainty or false positive stability within input noise.
-    //
-    // Produces correlation values with noticeable certainty tolerance around 33% from the math expected value of number `one` bits per synchro sequence length,
-    // where math expected value is equal to the half of synchro sequence length.
-    // For example, if synchro sequence has 20 bits length, then algorithm would output uncertain correlation values after a value greater than 33% of noised
-    // bits of 10 bits, i.e. greater than ~3 noised bits per each 20 bits in a bit stream.
-    //
-    //  Note:
-    //    Even if the algorithm has a complete instability for not false positive output if over a tolerance, but nonetheless that does not mean it is
-    //    stable enough below the tolerance. To increase the noise tolerance and gain more stability below the tolerance you must use the second phase algorithm.
+// Returns the number of the stream offsets to calculate the correlation mean values for a period.
+//
+inline uint64_t get_corr_mean_num_offsets(const CorrInParams & corr_in_params, uint64_t stream_bit_size, uint64_t period, uint32_t syncseq_min_repeat)
+{
+    uint64_t num_offsets = stream_bit_size - 1;
+
+    // skip all offsets if number of periods in an offset is greater than maximum
     //
-    // Memory complexity:   O(N * M) - to generate complement functions, O(N) - to calculate correlation values
-    // Time complexity:     O(N * M)
-    //                        , where N - stream bit length, M - synchro sequence bit length
+    if (corr_in_params.max_periods_in_offset != math::uint32_max) {
+        if (corr_in_params.max_periods_in_offset) {
+            // including first bit of next period
+            if (num_offsets / period >= corr_in_params.max_periods_in_offset) {
+                num_offsets = (std::min)(num_offsets, corr_in_params.max_periods_in_offset * period + 1);
+            }
+        }
+        else {
+            // excluding first bit of 2d period
+            num_offsets = (std::min)(num_offsets, period);
+        }
+    }
+
+    // skip all offsets if the number of left periods if less than minimal value
     //
+    const uint64_t min_repeat_bit_size = syncseq_min_repeat * period;
 
-    {
-        const auto begin_calc_phase_time = std::chrono::high_resolution_clock::now();
+    num_offsets = min_repeat_bit_size < stream_bit_size ? (std::min)(num_offsets, stream_bit_size - min_repeat_bit_size) : 0;
 
-        // Calculate correlation complement functions absolute maximums (by multiply to itself).
-        //
-        // Major time complexity: O(N * M), where N - stream bit length, M - synchro sequence bit length
-        //
+    return num_offsets;
+}
 
-        // calculate absolute maximums for the synchro sequence bits
-        syncseq_corr_absmax = multiply_bits(corr_in_params.corr_mm, syncseq_bytes, syncseq_bytes, syncseq_bit_size);
+template <typename T>
+struct CorrCombSum
+{
+    typename CorrValueTraits<T>::comb_sum_type sum;
+    uint32_t num_corr;                      // number of not filtered correlation values
+    uint32_t num_values;                    // number of correlation values including filtered
+};
 
-        // Calculate absolute maximums for the bit stream.
-        //
-        //
-        // Major time complexity: O(N * M), where N - stream bit length, M - synchro sequence bit length
-        //
+// Calculates the sums of the correlation values of all the offsets of a period by a sliding comb recurrence.
+//
+//  The offsets with the same remainder of a period share all the repeats except the first and the last, so the sum of an offset is calculated from
+//  the sum of the offset a period before by add of the newest repeat and subtract of the one that falls out.
+//
+// Time complexity: O(N + P * R), where N - number of offsets, P - period, R - maximum number of repeats
+//
+template <typename T>
+void calculate_corr_comb_sums(
+    const T * corr_values_arr, uint64_t stream_bit_size, uint64_t period, uint64_t num_offsets, uint32_t syncseq_max_repeat,
+    CorrCombSum<T> * corr_comb_sum_arr, uint64_t & num_corr_values_iter)
+{
+    // number of teeth of the comb, can be greater than number of values in the stream, then there is nothing to add
+    const uint64_t num_comb_teeth = (std::min)(uint64_t(syncseq_max_repeat) + 1, (stream_bit_size + period - 1) / period);
+    const uint64_t comb_bit_size = num_comb_teeth * period;
 
-        if_goto_b(phase11_break, true) {
-            size_t stream_bit_offset = 0;
+    for (uint64_t first_offset = 0; first_offset < (std::min)(period, num_offsets); first_offset++) {
+        CorrCombSum<T> corr_comb_sum{ 0, 0, 0 };
 
-            for (uint32_t from = 0; from < num_stream_32bit_blocks; from++) {
-                const uint64_t from64 = *(uint64_t *)(stream_buf32 + from);
+        for (uint64_t j = first_offset, repeat = 0; j < stream_bit_size && repeat < num_comb_teeth; j += period, repeat++) {
+            const T corr_value = corr_values_arr[size_t(j)];
 
-                for (uint32_t i = 0; i < 32; i++, stream_bit_offset++) {
-                    const uint32_t from_shifted = uint32_t(from64 >> i) & syncseq_mask;
+            if (corr_value) {
+                corr_comb_sum.sum += corr_value;
+                corr_comb_sum.num_corr++;
+            }
 
-                    stream_corr_absmax_arr[stream_bit_offset] = multiply_bits(corr_in_params.corr_mm, from_shifted, from_shifted, syncseq_bit_size);
+            corr_comb_sum.num_values++;
 
-                    // avoid calculation from zero padded array values
-                    if (stream_bit_offset >= stream_bit_size) {
-                        goto phase11_break;
-                    }
-                }
-            }
+            num_corr_values_iter++;
         }
 
-        float min_corr_value = math::float_max;
-        float max_corr_value = 0;
+        corr_comb_sum_arr[size_t(first_offset)] = corr_comb_sum;
 
-        uint32_t num_corr_values_calc = 0;
+        for (uint64_t i = first_offset + period; i < num_offsets; i += period) {
+            const T prev_corr_value = corr_values_arr[size_t(i - period)];
 
-        // Calculate correlation values.
-        //
-        // Major time complexity: O(N * M), where N - stream bit length, M - synchro sequence bit length
-        //
+            if (prev_corr_value) {
+                corr_comb_sum.sum -= prev_corr_value;
+                corr_comb_sum.num_corr--;
+            }
 
-        corr_values_arr.reserve((size_t(stream_bit_size)));
+            corr_comb_sum.num_values--;
 
-        // CAUTION:
-        //  We must avoid drop to zero before an autocorrelation calculation, because it will randomly distort the being multiplied functions length.
-        //
+            if (i - period + comb_bit_size < stream_bit_size) {
+                const T next_corr_value = corr_values_arr[size_t(i - period + comb_bit_size)];
 
-        if_goto_b(phase12_break, true) {
-            size_t stream_bit_offset = 0;
+                if (next_corr_value) {
+                    corr_comb_sum.sum += next_corr_value;
+                    corr_comb_sum.num_corr++;
+                }
 
-            for (uint32_t from = 0; from < num_stream_32bit_blocks; from++) {
-                const uint64_t from64 = *(uint64_t *)(stream_buf32 + from);
+                corr_comb_sum.num_values++;
 
-                for (uint32_t i = 0; i < 32; i++, stream_bit_offset++) {
-                    const uint32_t from_shifted = uint32_t(from64 >> i) & syncseq_mask;
+                num_corr_values_iter++;
+            }
 
-                    const auto corr_value = calculate_corr_value(
-                        corr_in_params.corr_mm,
-                        syncseq_bytes, from_shifted, syncseq_bit_size, syncseq_corr_absmax, stream_corr_absmax_arr[stream_bit_offset],
-                        corr_in_params.use_linear_corr);
+            num_corr_values_iter++;
 
-                    min_corr_value = (std::min)(min_corr_value, corr_value);
-                    max_corr_value = (std::max)(max_corr_value, corr_value);
+            corr_comb_sum_arr[size_t(i)] = corr_comb_sum;
+        }
+    }
+}
 
-                    if (corr_value >= corr_in_params.corr_min) {
-                        corr_values_arr.push_back(corr_value);
+// Sorts the records of an arena by the composite keys of the records and reorders the records once.
+//
+//  make_key:   void(size_t index, uint32_t (& key)[4]), makes the key words of a record from the least significant to the most significant
+//
+template <typename T, typename MakeKey>
+inline void radix_sort_corr_mean_arena(WorkStealingPool & pool, SyncseqCorrMeanArena<T> & arena, MakeKey make_key)
+{
+    const size_t size = arena.size();
 
-                        num_corr_values_calc++;
-                    }
-                    else if (!corr_in_params.no_zero_corr) {
-                        corr_values_arr.push_back(0);
-                    }
-                    else if (corr_in_params.corr_min) {
-                        corr_values_arr.push_back(corr_in_params.corr_min);
-                    }
-                    else {
-                        corr_values_arr.push_back(corr_in_params.use_linear_corr ? DEFAULT_LINEAR_CORR_MIN : DEFAULT_QUADRATIC_CORR_MIN);
-                    }
+    assert(size <= math::uint32_max);
 
-                    // avoid calculation from zero padded array values
-                    if (stream_bit_offset >= stream_bit_size) {
-                        goto phase12_break;
-                    }
-                }
-            }
-        }
+    std::vector<RadixSortKey> key_arr(size);
+    std::vector<RadixSortKey> buf_arr;
+    std::vector<size_t> index_arr(size);
 
-        end_calc_phase_time(_T("corr values"), begin_calc_phase_time, corr_out_params.calc_time_phases);
+    for (size_t i = 0; i < size; i++) {
+        RadixSortKey & key_ref = key_arr[i];
 
-        corr_out_params.num_corr_values_calc = num_corr_values_calc;
+        make_key(i, key_ref.key);
+        key_ref.index = uint32_t(i);
+    }
+
+    radix_sort(pool, key_arr, buf_arr);
 
-        corr_out_params.min_corr_value = min_corr_value;
-        corr_out_params.max_corr_value = max_corr_value;
+    for (size_t i = 0; i < size; i++) {
+        index_arr[i] = key_arr[i].index;
     }
 
-    switch (corr_in_params.impl_token) {
-    case Impl::impl_max_weighted_sum_of_corr_mean:
-    case Impl::impl_min_sum_of_corr_mean_deviat:
-    {
-        // Phase 2:
-        //
-        //  Correlation mean (average) values calculation, significantly increases algorithm certainty or false positive stability within input noise.
-        //
-        // Produces correlation mean values with noticeable certainty tolerance around 66% from the math expected value of number `one` bits per synchro sequence length,
-        // where math expected value is equal to the half of synchro sequence length.
-        // For example, if synchro sequence has 20 bits length, then algorithm would output uncertain correlation mean values after a value greater than 66% of noised
-        // bits of 10 bits, i.e. greater than ~6 noised bits per each 20 bits in a bit stream.
-        //
-        //  Note:
-        //    Even if the algorithm has a complete instability for not false positive output if over a tolerance, but nonetheless that does not mean it has
-        //    100% stability below the tolerance. In other words the algorithm just has no noted instability for not false positive output below the tolerance.
-        //    But still sometimes it happens to be instable below but near the tolerance.
-        //
-        // Float memory complexity:     from O(N) to O(N * N * ln(N)),
-        //                                depends on options, in approximation ~ O(N) for `/corr-mean-min 0.81`, `/max-corr-values-per-period <N>` and other options is default.
-        //                                If `/max-corr-values-per-period <K>`, then memory complexity reduces down to `O(N * K * ln(N))`.
-        // Major Time complexity:       O(N * N * ln(N))
-        //                                , where N - stream bit length, K < N
-        //
+    arena.permute(0, index_arr);
+}
 
-        corr_out_params.accum_corr_mean_calc = true;
+// Returns the first index of the greatest record in the same way as `std::max_element` over the records.
+//
+//  pred:   bool(size_t l, size_t r), the `less` predicate over the record indexes
+//
+template <typename Pred>
+inline size_t max_corr_mean_arena_index(size_t size, Pred pred)
+{
+    size_t max_index = 0;
 
-        // CAUTION:
-        //  The correlation values array (`corr_values_arr`) can has 0's values because values can be filtered out by the correlation minimum value.
-        //  What means we must skip usage of these values.
-        //
+    for (size_t i = 1; i < size; i++) {
+        if (pred(max_index, i)) {
+            max_index = i;
+        }
+    }
 
-        if (corr_in_params.impl_token == Impl::impl_max_weighted_sum_of_corr_mean) {
-            const auto begin_calc_phase_means_time = std::chrono::high_resolution_clock::now();
+    return max_index;
+}
 
-            //// calculate maximum storage size for correlation mean values to cancel calculations, rounding to greater
-            //const uint64_t corr_max_weighted_mean_sum_deq_max_size = (corr_in_params.max_corr_mean_bytes + sizeof(corr_max_weighted_mean_sum_deq[0]) - 1) / sizeof(corr_max_weighted_mean_sum_deq[0]);
-            //
-            //// x 10 to reserve space for at least 10 first results greater or equal than minimal correlation mean value
-            //const uint64_t corr_reserve_mean_arr_max_size = (std::min)(
-            //    corr_max_weighted_mean_sum_deq_max_size,
-            //    (stream_bit_size - 1) * (corr_in_params.corr_mean_min ? 10 : 1));
-            //
-            //corr_max_weighted_mean_sum_deq.reserve(size_t(corr_reserve_mean_arr_max_size));
+// Reserves the arena of correlation mean results by the initial capacity, but not greater than the upper bound of records: number of periods
+// multiplied by the maximum number of records per period. The arena grows on demand up to the maximum bytes, which is only the quit limit.
+//
+template <typename T>
+inline void reserve_corr_mean_arena(SyncseqCorrMeanArena<T> & arena, const CorrInParams & corr_in_params, uint64_t stream_min_period, uint64_t stream_max_period)
+{
+    const uint64_t num_periods = stream_max_period >= stream_min_period ? stream_max_period - stream_min_period + 1 : 0;
 
-            struct CorrOffsetMean
-            {
-                float corr_mean;
-                uint32_t num_corr;
-                uint64_t offset;
-            };
+    const bool is_offset64 = SyncseqCorrMeanArena<T>::is_offset64_stream(corr_in_params.stream_bit_size);
 
-            uint32_t num_corr_values_iter = 0;
+    const uint64_t init_records = (std::min)(num_periods * corr_in_params.max_corr_values_per_period, uint64_t(CORR_MEAN_ARENA_INIT_RECORDS));
 
-            uint32_t num_corr_means_calc = 0;
-            uint32_t num_corr_means_iter = 0;
+    arena.clear();
+    arena.reserve(size_t(init_records), is_offset64);
+}
 
-            size_t used_corr_mean_bytes = 0;
-            size_t accum_corr_mean_bytes = 0;
+// Phase 2 of the `impl_max_weighted_sum_of_corr_mean` implementation over the correlation values of a storage type.
+//
+template <typename T>
+void calculate_corr_mean_values(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrOutParams &                         corr_out_params,
+    const T *                               corr_values_arr,
+    float                                   corr_value_scale,
+    uint64_t                                stream_bit_size,
+    uint64_t                                stream_min_period,
+    uint64_t                                stream_max_period,
+    uint32_t                                syncseq_min_repeat,
+    uint32_t                                syncseq_max_repeat,
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena)
+{
+    struct CorrOffsetMean
+    {
+        float corr_mean;
+        uint32_t num_corr;
+        uint64_t offset;
+    };
 
-            float min_corr_mean_value = math::float_max;
-            float max_corr_mean_value = 0;
+    // correlation mean values of a single period
+    struct CorrPeriodMeans
+    {
+        std::vector<CorrOffsetMean> corr_max_means; // for different offsets
+        uint64_t                    num_corr_values_iter;
+        uint64_t                    num_corr_means_calc;
+        uint64_t                    num_corr_means_iter;
+        float                       min_corr_mean_value;
+        float                       max_corr_mean_value;
+    };
 
-            CorrOffsetMean corr_offset_mean;
+    struct CorrOffsetMeanPred
+    {
+        bool operator()(const CorrOffsetMean & l, const CorrOffsetMean & r) const
+        {
+            return l.corr_mean > r.corr_mean;
+        }
+    };
 
-            std::vector<CorrOffsetMean> corr_max_means_per_period; // for single period and different offsets
+    using CorrOffsetMeanTopKHeap = TopKHeap<CorrOffsetMean, CorrOffsetMeanPred>;
 
-            corr_max_means_per_period.reserve(corr_in_params.max_corr_values_per_period + 1); // plus one to resize back to maximum if greater
+    // buffers of a worker to reuse between periods
+    struct CorrWorkerBuffers
+    {
+        std::vector<CorrCombSum<T> > corr_comb_sum_arr; // for single period and different offsets, if the comb sum is used
+        CorrOffsetMeanTopKHeap corr_max_means_per_period; // for single period and different offsets
+    };
 
-            for (uint64_t period = stream_max_period; period >= stream_min_period; period--) {
-                corr_max_means_per_period.clear();
+    uint64_t num_corr_values_iter = 0;
 
-                for (uint64_t i = 0, j = i + period, repeat = 0; i < stream_bit_size - 1; i++, j = i + period, repeat = 0) {
-                    // skip all offsets if number of periods in an offset is greater than maximum
-                    //
-                    if (corr_in_params.max_periods_in_offset != math::uint32_max) {
-                        if (corr_in_params.max_periods_in_offset) {
-                            // including first bit of next period
-                            if (i / period >= corr_in_params.max_periods_in_offset && (i % period)) {
-                                break;
-                            }
-                        }
-                        else {
-                            // excluding first bit of 2d period
-                            if (i / period >= 1) {
-                                break;
-                            }
-                        }
-                    }
+    uint64_t num_corr_means_calc = 0;
+    uint64_t num_corr_means_iter = 0;
 
-                    // skip all offsets if the number of left periods if less than minimal value
-                    //
-                    if (syncseq_min_repeat >= (stream_bit_size - i + period - 1) / period) {
-                        break;
-                    }
+    size_t used_corr_mean_bytes = 0;
+    size_t accum_corr_mean_bytes = 0;
 
-                    const float first_corr_value = corr_values_arr[size_t(i)];
+    float min_corr_mean_value = math::float_max;
+    float max_corr_mean_value = 0;
 
-                    if (corr_in_params.skip_calc_on_filtered_corr_value_use && !first_corr_value) {
-                        goto skip_calc_on_filtered_corr_value_use_1;
-                    }
+    std::vector<CorrWorkerBuffers> corr_worker_buffers_arr;
 
-                    corr_offset_mean = CorrOffsetMean{ first_corr_value, first_corr_value ? 1U : 0U, i };
+    corr_worker_buffers_arr.reserve(pool.num_workers());
 
-                    num_corr_values_iter++;
+    for (size_t i = 0; i < pool.num_workers(); i++) {
+        corr_worker_buffers_arr.push_back(CorrWorkerBuffers{
+            {}, CorrOffsetMeanTopKHeap{ corr_in_params.max_corr_values_per_period, CorrOffsetMeanPred{} }
+        });
+    }
 
-                    for (; j < stream_bit_size && repeat < syncseq_max_repeat; j += period, repeat++) {
-                        const float next_corr_value = corr_values_arr[size_t(j)];
+    // calculates a period in a worker
+    auto calculate_period = [&](size_t worker_index, uint64_t period_index, CorrPeriodMeans & corr_period_means) {
+        const uint64_t period = stream_max_period - period_index;
 
-                        if (corr_in_params.skip_calc_on_filtered_corr_value_use && !next_corr_value) {
-                            goto skip_calc_on_filtered_corr_value_use_1;
-                        }
+        CorrWorkerBuffers & corr_worker_buffers = corr_worker_buffers_arr[worker_index];
 
-                        if (next_corr_value) {
-                            corr_offset_mean.corr_mean += next_corr_value;
-                            corr_offset_mean.num_corr++;
-                        }
+        std::vector<CorrCombSum<T> > & corr_comb_sum_arr = corr_worker_buffers.corr_comb_sum_arr;
+        CorrOffsetMeanTopKHeap & corr_max_means_per_period = corr_worker_buffers.corr_max_means_per_period;
 
-                        num_corr_values_iter++;
-                    }
+        uint64_t num_corr_values_iter = 0;
 
-                    assert(repeat + 1 >= corr_offset_mean.num_corr);
+        uint64_t num_corr_means_calc = 0;
+        uint64_t num_corr_means_iter = 0;
 
-                    // must be at least 1 repeat
-                    if (corr_offset_mean.num_corr >= 1 + syncseq_min_repeat) {
-                        corr_offset_mean.corr_mean /= corr_offset_mean.num_corr;
+        float min_corr_mean_value = math::float_max;
+        float max_corr_mean_value = 0;
 
-                        if (corr_offset_mean.corr_mean >= corr_in_params.corr_mean_min) {
-                            utils::insert_sorted(corr_max_means_per_period, corr_offset_mean, [](const CorrOffsetMean & l, const CorrOffsetMean & r) -> bool {
-                                return l.corr_mean > r.corr_mean;
-                            });
+        CorrOffsetMean corr_offset_mean;
 
-                            if (corr_max_means_per_period.size() > corr_in_params.max_corr_values_per_period) {
-                                corr_max_means_per_period.resize(corr_in_params.max_corr_values_per_period);
-                            }
+        typename CorrValueTraits<T>::sum_type corr_sum;
 
-                            num_corr_means_calc++;
-                        }
-                    }
+        corr_max_means_per_period.clear();
 
-                    num_corr_means_iter++;
+        const uint64_t num_offsets = get_corr_mean_num_offsets(corr_in_params, stream_bit_size, period, syncseq_min_repeat);
 
-                    if (corr_offset_mean.corr_mean && corr_offset_mean.num_corr) {
-                        min_corr_mean_value = (std::min)(min_corr_mean_value, corr_offset_mean.corr_mean);
-                        max_corr_mean_value = (std::max)(max_corr_mean_value, corr_offset_mean.corr_mean);
-                    }
+        if (corr_in_params.use_comb_corr_sum) {
+            corr_comb_sum_arr.resize(size_t(num_offsets));
+
+            calculate_corr_comb_sums(corr_values_arr, stream_bit_size, period, num_offsets, syncseq_max_repeat, corr_comb_sum_arr.data(), num_corr_values_iter);
+        }
 
-                skip_calc_on_filtered_corr_value_use_1:;
+        for (uint64_t i = 0, j = i + period, repeat = 0; i < num_offsets; i++, j = i + period, repeat = 0) {
+            if (corr_in_params.use_comb_corr_sum) {
+                const CorrCombSum<T> & corr_comb_sum = corr_comb_sum_arr[size_t(i)];
+
+                if (corr_in_params.skip_calc_on_filtered_corr_value_use && corr_comb_sum.num_corr < corr_comb_sum.num_values) {
+                    goto skip_calc_on_filtered_corr_value_use_1;
                 }
 
-                for (const auto & corr_max_mean : corr_max_means_per_period) {
-                    corr_max_weighted_mean_sum_deq.push_back(SyncseqCorrMean{
-                        uint32_t(corr_max_mean.offset), uint32_t(period), corr_max_mean.num_corr, corr_max_mean.corr_mean, 0
-                        });
+                corr_offset_mean = CorrOffsetMean{ CorrValueTraits<T>::to_float(corr_comb_sum.sum, corr_value_scale), corr_comb_sum.num_corr, i };
+            }
+            else {
+                const T first_corr_value = corr_values_arr[size_t(i)];
+
+                if (corr_in_params.skip_calc_on_filtered_corr_value_use && !first_corr_value) {
+                    goto skip_calc_on_filtered_corr_value_use_1;
                 }
 
-                used_corr_mean_bytes = (std::max)(used_corr_mean_bytes, corr_max_weighted_mean_sum_deq.size() * sizeof(corr_max_weighted_mean_sum_deq[0]));
-                accum_corr_mean_bytes = (std::max)(accum_corr_mean_bytes, corr_max_weighted_mean_sum_deq.size() * sizeof(corr_max_weighted_mean_sum_deq[0]));
+                corr_sum = first_corr_value;
 
-                if (accum_corr_mean_bytes >= corr_in_params.max_corr_mean_bytes) {
-                    // out of buffer, cancel calculation
-                    corr_out_params.accum_corr_mean_quit = true;
-                    break;
+                corr_offset_mean = CorrOffsetMean{ 0, first_corr_value ? 1U : 0U, i };
+
+                num_corr_values_iter++;
+
+                for (; j < stream_bit_size && repeat < syncseq_max_repeat; j += period, repeat++) {
+                    const T next_corr_value = corr_values_arr[size_t(j)];
+
+                    if (corr_in_params.skip_calc_on_filtered_corr_value_use && !next_corr_value) {
+                        goto skip_calc_on_filtered_corr_value_use_1;
+                    }
+
+                    if (next_corr_value) {
+                        corr_sum += next_corr_value;
+                        corr_offset_mean.num_corr++;
+                    }
+
+                    num_corr_values_iter++;
                 }
-            }
 
-            end_calc_phase_time(_T("corr mean values"), begin_calc_phase_means_time, corr_out_params.calc_time_phases);
+                assert(repeat + 1 >= corr_offset_mean.num_corr);
 
-            corr_out_params.min_corr_mean = min_corr_mean_value;
-            corr_out_params.max_corr_mean = max_corr_mean_value;
+                corr_offset_mean.corr_mean = CorrValueTraits<T>::to_float(corr_sum, corr_value_scale);
+            }
 
-            corr_out_params.num_corr_values_iterated = num_corr_values_iter;
+            // must be at least 1 repeat
+            if (corr_offset_mean.num_corr >= 1 + syncseq_min_repeat) {
+                corr_offset_mean.corr_mean /= corr_offset_mean.num_corr;
 
-            corr_out_params.num_corr_means_calc = num_corr_means_calc;
-            corr_out_params.num_corr_means_iterated = num_corr_means_iter;
+                if (corr_offset_mean.corr_mean >= corr_in_params.corr_mean_min) {
+                    corr_max_means_per_period.push(corr_offset_mean);
 
-            corr_out_params.used_corr_mean_bytes = used_corr_mean_bytes;
-            corr_out_params.accum_corr_mean_bytes = accum_corr_mean_bytes;
+                    num_corr_means_calc++;
+                }
+            }
 
-            const auto corr_max_weighted_mean_sum_deq_size = corr_max_weighted_mean_sum_deq.size();
+            num_corr_means_iter++;
 
-            if (!corr_max_weighted_mean_sum_deq_size) {
-                break;
+            if (corr_offset_mean.corr_mean && corr_offset_mean.num_corr) {
+                min_corr_mean_value = (std::min)(min_corr_mean_value, corr_offset_mean.corr_mean);
+                max_corr_mean_value = (std::max)(max_corr_mean_value, corr_offset_mean.corr_mean);
             }
 
-            if (!corr_in_params.skip_max_weighted_sum_of_corr_mean_calc) {
-                // Phase 3:
-                //
-                //  Correlation maximum mean (average) values weighted sum calculation, makes groups of offsets grouped with a multiple by a period,
-                //  where groups sorted by offset and then by period in a group. Or in another words does calculate weighted sums of maximal mean values
-                //  in groups calculated for the same offset with a multiple by a period.
-                //
-                //  The output is sorted by maximum mean sum from maximum to minimum, then by offset from minimum to maximum and then by period for an
-                //  offset from minimum to maximum.
-                //
-                //  NOTE:
-                //    For speedup reasons the sort by offset does for the first mean sum, by period - for the first offset.
-                //
-                //  Helps to resort found offsets and periods to locate more certain values which brings even more stability for false positives.
-                //
-                //  The idea is to put the set of solutions with tolerance-equal mean sums which can be in different order:
-                //
-                //    offset  | period
-                //  ----------+--------
-                //  x         | k
-                //  x         | k * 2
-                //  x         | k * 3
-                //  x         | k * m
-                //  x + k     | k * m
-                //  x + k * 2 | k * m
-                //  x + k * 3 | k * m
-                //  x + k * n | k * m
-                //
-                //  Into sorted order, where x, k, n, m - is a possible minimum.
-                //
-                //  Memory complexity:   O(N) - input, O(N) - output
-                //  Time complexity:     O(N  * M)
-                //                         , where N - stream bit length, M - number of used periods per offset
-                //
-                //  Example:
-                //
-                //   index |   max mean   | num corr |  offset  |  period
-                //  -------+--------------+----------+----------+---------
-                //     1   |    0.850     |    30    |    20    |    33
-                //     2   |    0.845     |     5    |    10    |   200
-                //     3   |    0.841     |    11    |    30    |    90
-                //     4   |    0.836     |    11    |    10    |   100
-                //     5   |    0.831     |     6    |   100    |   165
-                //     6   |    0.823     |    17    |   100    |    55
-                //
-                //  After sort the table above, the result will be:
-                //
-                //         |   max mean   |          |
-                //   index | weighted sum |  offset  |  period
-                //  -------+--------------+----------+---------
-                //     4   |    1.1174    |    10    |   100
-                //     2   |    1.1174    |    10    |   200
-                //     6   |    1.0082    |   100    |    55
-                //     5   |    1.0082    |   100    |   165
-                //     1   |    0.850     |    20    |    33
-                //     3   |    0.841     |    30    |    90
-                //
-                //   , where:
-                //
-                //     1.1174 = 0.836 + 0.845 * (5 - 1) / (11 - 1)
-                //     1.0082 = 0.823 + 0.831 * (6 - 1) / (17 - 1)
-                //
-
-                const auto begin_calc_weighted_means_sum_time = std::chrono::high_resolution_clock::now();
-
-                auto begin_it = corr_max_weighted_mean_sum_deq.begin();
-                auto end_it = corr_max_weighted_mean_sum_deq.end();
-
-                // sort by offset
-
-                std::sort(begin_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                {
-                    return l.offset < r.offset;
+        skip_calc_on_filtered_corr_value_use_1:;
+        }
+
+        corr_period_means = CorrPeriodMeans{
+            {}, num_corr_values_iter, num_corr_means_calc, num_corr_means_iter, min_corr_mean_value, max_corr_mean_value
+        };
+
+        corr_max_means_per_period.extract_sorted(corr_period_means.corr_max_means);
+    };
+
+    // merges a period strictly in the order of periods, so the result does not depend on the number of workers
+    auto merge_period = [&](uint64_t period_index, CorrPeriodMeans & corr_period_means) -> bool {
+        const uint64_t period = stream_max_period - period_index;
+
+        num_corr_values_iter += corr_period_means.num_corr_values_iter;
+
+        num_corr_means_calc += corr_period_means.num_corr_means_calc;
+        num_corr_means_iter += corr_period_means.num_corr_means_iter;
+
+        min_corr_mean_value = (std::min)(min_corr_mean_value, corr_period_means.min_corr_mean_value);
+        max_corr_mean_value = (std::max)(max_corr_mean_value, corr_period_means.max_corr_mean_value);
+
+        for (const auto & corr_max_mean : corr_period_means.corr_max_means) {
+            corr_max_weighted_mean_sum_arena.push_back(SyncseqCorrMean{
+                corr_max_mean.offset, uint32_t(period), corr_max_mean.num_corr, corr_max_mean.corr_mean, 0
                 });
+        }
 
-                // sort by period in an offset
+        accum_corr_mean_bytes = corr_max_weighted_mean_sum_arena.bytes();
+        used_corr_mean_bytes = accum_corr_mean_bytes;
 
-                size_t step;
+        if (accum_corr_mean_bytes >= corr_in_params.max_corr_mean_bytes) {
+            // out of buffer, cancel calculation
+            corr_out_params.accum_corr_mean_quit = true;
+            return false;
+        }
 
-                auto first_it = begin_it;
+        return true;
+    };
 
-                auto prev_it = begin_it;
-                auto next_it = prev_it;
+    reserve_corr_mean_arena(corr_max_weighted_mean_sum_arena, corr_in_params, stream_min_period, stream_max_period);
 
-                for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                    auto & corr_max_mean_prev_ref = *prev_it;
-                    auto & corr_max_mean_next_ref = *next_it;
+    if (stream_max_period >= stream_min_period) {
+        pool.run_ordered<CorrPeriodMeans>(stream_max_period - stream_min_period + 1, calculate_period, merge_period);
+    }
 
-                    if (corr_max_mean_prev_ref.offset != corr_max_mean_next_ref.offset) {
-                        if (step > 1) {
-                            std::sort(first_it, next_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                            {
-                                return l.period > r.period;
-                            });
-                        }
 
-                        first_it = next_it;
-                        step = 0;
-                    }
-                }
+    corr_out_params.min_corr_mean = min_corr_mean_value;
+    corr_out_params.max_corr_mean = max_corr_mean_value;
 
-                // calculate correlation mean weights and local mean sums, O(N * M) time complexity
+    corr_out_params.num_corr_values_iterated = size_t(num_corr_values_iter);
 
-                first_it = begin_it;
+    corr_out_params.num_corr_means_calc = size_t(num_corr_means_calc);
+    corr_out_params.num_corr_means_iterated = size_t(num_corr_means_iter);
 
-                prev_it = begin_it;
-                next_it = prev_it;
+    corr_out_params.used_corr_mean_bytes = used_corr_mean_bytes;
+    corr_out_params.accum_corr_mean_bytes = accum_corr_mean_bytes;
+}
 
-                for (next_it++; next_it != end_it; prev_it = next_it, next_it++) {
-                    auto & corr_max_mean_prev_ref = *prev_it;
-                    auto & corr_max_mean_next_ref = *next_it;
+// Phase 2 of the `impl_min_sum_of_corr_mean_deviat` implementation over the correlation values of a storage type.
+//
+//  If the correlation mean values arena is not null, then the Phase 2 of the `impl_max_weighted_sum_of_corr_mean` implementation is calculated
+//  in the same pass (`impl_ensemble_of_corr_mean`). Both implementations select the same correlation mean values per offset, so the results are
+//  the same as of separate calculations.
+//
+template <typename T>
+void calculate_corr_mean_deviat_values(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrOutParams &                         corr_out_params,
+    const T *                               corr_values_arr,
+    float                                   corr_value_scale,
+    uint64_t                                stream_bit_size,
+    uint64_t                                stream_min_period,
+    uint64_t                                stream_max_period,
+    uint32_t                                syncseq_min_repeat,
+    uint32_t                                syncseq_max_repeat,
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena,
+    SyncseqCorrMeanSoA *                    corr_max_weighted_mean_sum_arena_ptr)
+{
+    struct CorrOffsetMeanDeviat
+    {
+        float corr_mean;
+        float corr_mean_deviat_sum;
+        uint32_t num_corr;
+        uint64_t offset;
+    };
 
-                    if (corr_max_mean_prev_ref.offset == corr_max_mean_next_ref.offset) {
-                        corr_max_mean_prev_ref.corr_mean_sum = corr_max_mean_prev_ref.corr_mean * (corr_max_mean_prev_ref.num_corr - 1);
-                    }
-                    else {
-                        corr_max_mean_prev_ref.corr_mean_sum = corr_max_mean_prev_ref.corr_mean;
+    // correlation mean deviation values of a single period
+    struct CorrPeriodMeanDeviats
+    {
+        std::vector<CorrOffsetMeanDeviat> corr_min_mean_deviat_sums; // for different offsets
+        std::vector<CorrOffsetMeanDeviat> corr_max_means; // for different offsets, if the correlation mean values arena is used
+        uint64_t                    num_corr_values_iter;
+        uint64_t                    num_corr_means_calc;
+        uint64_t                    num_corr_means_iter;
+        float                       min_corr_mean_value;
+        float                       max_corr_mean_value;
+        float                       min_corr_mean_deviat_value;
+        float                       max_corr_mean_deviat_value;
+    };
 
-                        // accumulate mean sum for a minimal period
-                        for (auto it = first_it; it != prev_it; it++) {
-                            if (!(it->period % corr_max_mean_prev_ref.period)) {
-                                corr_max_mean_prev_ref.corr_mean_sum += it->corr_mean_sum / (corr_max_mean_prev_ref.num_corr - 1);
-                            }
-                        }
+    struct CorrOffsetMeanDeviatPred
+    {
+        bool sort_at_first_by_max_corr_mean;
 
-                        first_it = next_it;
-                    }
+        bool operator()(const CorrOffsetMeanDeviat & l, const CorrOffsetMeanDeviat & r) const
+        {
+            return !sort_at_first_by_max_corr_mean ? l.corr_mean_deviat_sum < r.corr_mean_deviat_sum : l.corr_mean > r.corr_mean;
+        }
+    };
+
+    using CorrOffsetMeanDeviatTopKHeap = TopKHeap<CorrOffsetMeanDeviat, CorrOffsetMeanDeviatPred>;
+
+    // buffers of a worker to reuse between periods
+    struct CorrWorkerBuffers
+    {
+        std::vector<CorrCombSum<T> > corr_comb_sum_arr; // for single period and different offsets, if the comb sum is used
+        std::vector<float> corr_offset_value_arr; // not zero correlation values of single offset in the order of repeats
+        CorrOffsetMeanDeviatTopKHeap corr_min_mean_deviat_sum_per_period; // for single period and different offsets
+        CorrOffsetMeanDeviatTopKHeap corr_max_means_per_period; // for single period and different offsets, if the correlation mean values arena is used
+    };
+
+    uint64_t num_corr_values_iter = 0;
+
+    uint64_t num_corr_means_calc = 0;
+    uint64_t num_corr_means_iter = 0;
+
+    size_t used_corr_mean_bytes = 0;
+    size_t accum_corr_mean_bytes = 0;
+
+    float min_corr_mean_value = math::float_max;
+    float max_corr_mean_value = 0;
+
+    float min_corr_mean_deviat_value = math::float_max;
+    float max_corr_mean_deviat_value = 0;
+
+    // maximal number of correlation values of single offset
+    const size_t max_offset_values = size_t((std::min)(uint64_t(syncseq_max_repeat), (stream_bit_size - 1) / (std::max)(stream_min_period, uint64_t(1)))) + 1;
+
+    std::vector<CorrWorkerBuffers> corr_worker_buffers_arr;
+
+    corr_worker_buffers_arr.reserve(pool.num_workers());
+
+    for (size_t i = 0; i < pool.num_workers(); i++) {
+        corr_worker_buffers_arr.push_back(CorrWorkerBuffers{
+            {}, std::vector<float>(max_offset_values),
+            CorrOffsetMeanDeviatTopKHeap{ corr_in_params.max_corr_values_per_period, CorrOffsetMeanDeviatPred{ corr_in_params.sort_at_first_by_max_corr_mean } },
+            CorrOffsetMeanDeviatTopKHeap{ corr_in_params.max_corr_values_per_period, CorrOffsetMeanDeviatPred{ true } }
+        });
+    }
+
+    // calculates a period in a worker
+    auto calculate_period = [&](size_t worker_index, uint64_t period_index, CorrPeriodMeanDeviats & corr_period_mean_deviats) {
+        const uint64_t period = stream_max_period - period_index;
+
+        CorrWorkerBuffers & corr_worker_buffers = corr_worker_buffers_arr[worker_index];
+
+        std::vector<CorrCombSum<T> > & corr_comb_sum_arr = corr_worker_buffers.corr_comb_sum_arr;
+        float * corr_offset_value_ptr = corr_worker_buffers.corr_offset_value_arr.data();
+        CorrOffsetMeanDeviatTopKHeap & corr_min_mean_deviat_sum_per_period = corr_worker_buffers.corr_min_mean_deviat_sum_per_period;
+        CorrOffsetMeanDeviatTopKHeap & corr_max_means_per_period = corr_worker_buffers.corr_max_means_per_period;
+
+        uint64_t num_corr_values_iter = 0;
+
+        uint64_t num_corr_means_calc = 0;
+        uint64_t num_corr_means_iter = 0;
+
+        float min_corr_mean_value = math::float_max;
+        float max_corr_mean_value = 0;
+
+        float min_corr_mean_deviat_value = math::float_max;
+        float max_corr_mean_deviat_value = 0;
+
+        CorrOffsetMeanDeviat corr_offset_mean_deviat;
+
+        typename CorrValueTraits<T>::sum_type corr_sum;
+
+        size_t num_offset_values;
+
+        corr_min_mean_deviat_sum_per_period.clear();
+        corr_max_means_per_period.clear();
+
+        const uint64_t num_offsets = get_corr_mean_num_offsets(corr_in_params, stream_bit_size, period, syncseq_min_repeat);
+
+        if (corr_in_params.use_comb_corr_sum) {
+            corr_comb_sum_arr.resize(size_t(num_offsets));
+
+            calculate_corr_comb_sums(corr_values_arr, stream_bit_size, period, num_offsets, syncseq_max_repeat, corr_comb_sum_arr.data(), num_corr_values_iter);
+        }
+
+        // NOTE:
+        //  The not zero correlation values of an offset are collected while the mean is calculated, so the deviation sum is calculated over
+        //  the collected values without the second pass over the strided correlation values. The mean absolute deviation can not be
+        //  accumulated in a single pass as the variance, because depends on the mean, but the values are collected in the same order, so
+        //  the result is the same.
+        //
+        for (uint64_t i = 0, j = i + period, repeat = 0; i < num_offsets; i++, j = i + period, repeat = 0) {
+            const T first_corr_value = corr_values_arr[size_t(i)];
+
+            num_offset_values = 0;
+
+            if (corr_in_params.use_comb_corr_sum) {
+                const CorrCombSum<T> & corr_comb_sum = corr_comb_sum_arr[size_t(i)];
+
+                if (corr_in_params.skip_calc_on_filtered_corr_value_use && corr_comb_sum.num_corr < corr_comb_sum.num_values) {
+                    goto skip_calc_on_filtered_corr_value_use_2;
                 }
 
-                auto & corr_max_mean_last_ref = corr_max_weighted_mean_sum_deq.back();
+                corr_offset_mean_deviat = CorrOffsetMeanDeviat{ CorrValueTraits<T>::to_float(corr_comb_sum.sum, corr_value_scale), 0, corr_comb_sum.num_corr, i };
+            }
+            else {
+                if (corr_in_params.skip_calc_on_filtered_corr_value_use && !first_corr_value) {
+                    goto skip_calc_on_filtered_corr_value_use_2;
+                }
 
-                corr_max_mean_last_ref.corr_mean_sum = corr_max_mean_last_ref.corr_mean;
+                corr_sum = first_corr_value;
 
-                // accumulate mean sum for a minimal period
-                for (auto it = first_it; it != prev_it; it++) {
-                    if (!(it->period % prev_it->period)) {
-                        prev_it->corr_mean_sum += it->corr_mean_sum / (prev_it->num_corr - 1);
+                corr_offset_mean_deviat = CorrOffsetMeanDeviat{ 0, 0, first_corr_value ? 1U : 0U, i };
+
+                // overwritten by the next value if zero
+                corr_offset_value_ptr[0] = CorrValueTraits<T>::to_float(first_corr_value, corr_value_scale);
+
+                num_corr_values_iter++;
+
+                for ( ; j < stream_bit_size && repeat < syncseq_max_repeat; j += period, repeat++) {
+                    const T next_corr_value = corr_values_arr[size_t(j)];
+
+                    if (corr_in_params.skip_calc_on_filtered_corr_value_use && !next_corr_value) {
+                        goto skip_calc_on_filtered_corr_value_use_2;
+                    }
+
+                    if (next_corr_value) {
+                        corr_sum += next_corr_value;
+                        corr_offset_value_ptr[corr_offset_mean_deviat.num_corr++] = CorrValueTraits<T>::to_float(next_corr_value, corr_value_scale);
                     }
+
+                    num_corr_values_iter++;
                 }
 
-                // calculate correlation mean sum, O(N) time complexity
+                assert(repeat + 1 >= corr_offset_mean_deviat.num_corr);
 
-                auto begin_rit = corr_max_weighted_mean_sum_deq.rbegin();
-                auto end_rit = corr_max_weighted_mean_sum_deq.rend();
+                num_offset_values = corr_offset_mean_deviat.num_corr;
 
-                auto first_rit = begin_rit;
+                corr_offset_mean_deviat.corr_mean = CorrValueTraits<T>::to_float(corr_sum, corr_value_scale);
+            }
 
-                auto prev_rit = begin_rit;
-                auto next_rit = prev_rit;
+            // must be at least 1 repeat
+            if (corr_offset_mean_deviat.num_corr >= 1 + syncseq_min_repeat) {
+                corr_offset_mean_deviat.corr_mean /= corr_offset_mean_deviat.num_corr;
 
-                for (next_rit++; next_rit != end_rit; prev_rit = next_rit, next_rit++) {
-                    auto & corr_max_mean_prev_ref = *prev_rit;
-                    auto & corr_max_mean_next_ref = *next_rit;
+                if (corr_offset_mean_deviat.corr_mean >= corr_in_params.corr_mean_min) {
+                    if (corr_in_params.use_comb_corr_sum) {
+                        // the comb sum has not iterated the values of the offset, collect them here
 
-                    if (corr_max_mean_prev_ref.offset == corr_max_mean_next_ref.offset) {
-                        if (!(corr_max_mean_next_ref.period % first_rit->period)) {
-                            corr_max_mean_next_ref.corr_mean_sum = first_rit->corr_mean_sum;
+                        if (first_corr_value) {
+                            corr_offset_value_ptr[num_offset_values++] = CorrValueTraits<T>::to_float(first_corr_value, corr_value_scale);
                         }
-                        else { // not a multiple by a minimal period, reset to mean value
-                            corr_max_mean_next_ref.corr_mean_sum = corr_max_mean_next_ref.corr_mean;
+
+                        for (j = i + period, repeat = 0; j < stream_bit_size && repeat < syncseq_max_repeat; j += period, repeat++) {
+                            const T next_corr_value = corr_values_arr[size_t(j)];
+
+                            if (next_corr_value) {
+                                corr_offset_value_ptr[num_offset_values++] = CorrValueTraits<T>::to_float(next_corr_value, corr_value_scale);
+                            }
                         }
                     }
-                    else {
-                        first_rit = next_rit;
+
+                    // calculate deviation sum
+
+                    for (size_t k = 0; k < num_offset_values; k++) {
+                        const float corr_deviat_value = std::fabs(corr_offset_mean_deviat.corr_mean - corr_offset_value_ptr[k]);
+
+                        corr_offset_mean_deviat.corr_mean_deviat_sum += corr_deviat_value;
+
+                        min_corr_mean_deviat_value = (std::min)(min_corr_mean_deviat_value, corr_deviat_value);
+                        max_corr_mean_deviat_value = (std::max)(max_corr_mean_deviat_value, corr_deviat_value);
                     }
+
+                    // mean sum of mean deviation
+                    corr_offset_mean_deviat.corr_mean_deviat_sum /= corr_offset_mean_deviat.num_corr;
+
+                    // CAUTION:
+                    //  May lose elements with minimum correlation mean deviation sum if `/sort-at-first-by-max-corr-mean` is defined.
+                    //
+                    corr_min_mean_deviat_sum_per_period.push(corr_offset_mean_deviat);
+
+                    if (corr_max_weighted_mean_sum_arena_ptr) {
+                        corr_max_means_per_period.push(corr_offset_mean_deviat);
+                    }
+
+                    num_corr_means_calc++;
                 }
+            }
 
-                if (corr_in_params.return_sorted_result) {
-                    // sort by correlation mean sum
+            num_corr_means_iter++;
 
-                    std::sort(begin_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                    {
-                        return l.corr_mean_sum > r.corr_mean_sum;
-                    });
+            if (corr_offset_mean_deviat.corr_mean && corr_offset_mean_deviat.num_corr) {
+                min_corr_mean_value = (std::min)(min_corr_mean_value, corr_offset_mean_deviat.corr_mean);
+                max_corr_mean_value = (std::max)(max_corr_mean_value, corr_offset_mean_deviat.corr_mean);
+            }
 
-                    // sort by offset in a correlation mean sum
+        skip_calc_on_filtered_corr_value_use_2:;
+        }
 
-                    first_it = begin_it;
+        corr_period_mean_deviats = CorrPeriodMeanDeviats{
+            {}, {}, num_corr_values_iter, num_corr_means_calc, num_corr_means_iter, min_corr_mean_value, max_corr_mean_value, min_corr_mean_deviat_value, max_corr_mean_deviat_value
+        };
 
-                    prev_it = begin_it;
-                    next_it = prev_it;
+        corr_min_mean_deviat_sum_per_period.extract_sorted(corr_period_mean_deviats.corr_min_mean_deviat_sums);
+        corr_max_means_per_period.extract_sorted(corr_period_mean_deviats.corr_max_means);
+    };
 
-                    for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                        auto & corr_max_mean_prev_ref = *prev_it;
-                        auto & corr_max_mean_next_ref = *next_it;
+    // merges a period strictly in the order of periods, so the result does not depend on the number of workers
+    auto merge_period = [&](uint64_t period_index, CorrPeriodMeanDeviats & corr_period_mean_deviats) -> bool {
+        const uint64_t period = stream_max_period - period_index;
 
-                        if (corr_max_mean_prev_ref.corr_mean_sum != corr_max_mean_next_ref.corr_mean_sum) {
-                            if (step > 1) {
-                                std::sort(first_it, next_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                                {
-                                    return l.offset < r.offset;
-                                });
-                            }
+        num_corr_values_iter += corr_period_mean_deviats.num_corr_values_iter;
 
-                            first_it = next_it;
-                            step = 0;
-                        }
-                    }
+        num_corr_means_calc += corr_period_mean_deviats.num_corr_means_calc;
+        num_corr_means_iter += corr_period_mean_deviats.num_corr_means_iter;
 
-                    // sort the last
-                    if (step > 1) {
-                        std::sort(first_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                        {
-                            return l.offset < r.offset;
-                        });
-                    }
+        min_corr_mean_value = (std::min)(min_corr_mean_value, corr_period_mean_deviats.min_corr_mean_value);
+        max_corr_mean_value = (std::max)(max_corr_mean_value, corr_period_mean_deviats.max_corr_mean_value);
 
-                    // sort by period in an offset
+        min_corr_mean_deviat_value = (std::min)(min_corr_mean_deviat_value, corr_period_mean_deviats.min_corr_mean_deviat_value);
+        max_corr_mean_deviat_value = (std::max)(max_corr_mean_deviat_value, corr_period_mean_deviats.max_corr_mean_deviat_value);
 
-                    first_it = begin_it;
+        for (const auto & corr_min_mean_deviat : corr_period_mean_deviats.corr_min_mean_deviat_sums) {
+            corr_min_mean_deviat_sum_arena.push_back(SyncseqCorrMeanDeviat{
+                corr_min_mean_deviat.offset, uint32_t(period), corr_min_mean_deviat.num_corr, corr_min_mean_deviat.corr_mean, corr_min_mean_deviat.corr_mean_deviat_sum
+            });
+        }
 
-                    prev_it = begin_it;
-                    next_it = prev_it;
+        accum_corr_mean_bytes = corr_min_mean_deviat_sum_arena.bytes();
 
-                    for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                        auto & corr_max_mean_prev_ref = *prev_it;
-                        auto & corr_max_mean_next_ref = *next_it;
+        // NOTE:
+        //  The arenas have the same number of records, so the buffer limit is applied to each arena.
+        //
+        if (corr_max_weighted_mean_sum_arena_ptr) {
+            for (const auto & corr_max_mean : corr_period_mean_deviats.corr_max_means) {
+                corr_max_weighted_mean_sum_arena_ptr->push_back(SyncseqCorrMean{
+                    corr_max_mean.offset, uint32_t(period), corr_max_mean.num_corr, corr_max_mean.corr_mean, 0
+                });
+            }
 
-                        if (corr_max_mean_prev_ref.corr_mean_sum != corr_max_mean_next_ref.corr_mean_sum || corr_max_mean_prev_ref.offset != corr_max_mean_next_ref.offset) {
-                            if (step > 1) {
-                                std::sort(first_it, next_it, [&](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                                {
-                                    return l.period < r.period;
-                                });
-                            }
+            accum_corr_mean_bytes += corr_max_weighted_mean_sum_arena_ptr->bytes();
+        }
 
-                            first_it = next_it;
-                            step = 0;
-                        }
-                    }
+        used_corr_mean_bytes = accum_corr_mean_bytes;
 
-                    // sort the last
-                    if (step > 1) {
-                        std::sort(first_it, end_it, [&](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                        {
-                            return l.period < r.period;
-                        });
-                    }
+        if (corr_min_mean_deviat_sum_arena.bytes() >= corr_in_params.max_corr_mean_bytes) {
+            // out of buffer, cancel calculation
+            corr_out_params.accum_corr_mean_quit = true;
+            return false;
+        }
+
+        return true;
+    };
+
+    reserve_corr_mean_arena(corr_min_mean_deviat_sum_arena, corr_in_params, stream_min_period, stream_max_period);
+
+    if (corr_max_weighted_mean_sum_arena_ptr) {
+        reserve_corr_mean_arena(*corr_max_weighted_mean_sum_arena_ptr, corr_in_params, stream_min_period, stream_max_period);
+    }
+
+    if (stream_max_period >= stream_min_period) {
+        pool.run_ordered<CorrPeriodMeanDeviats>(stream_max_period - stream_min_period + 1, calculate_period, merge_period);
+    }
+
+
+    corr_out_params.min_corr_mean = min_corr_mean_value;
+    corr_out_params.max_corr_mean = max_corr_mean_value;
+
+    corr_out_params.min_corr_mean_deviat = min_corr_mean_deviat_value;
+    corr_out_params.max_corr_mean_deviat = max_corr_mean_deviat_value;
+
+    corr_out_params.num_corr_values_iterated = size_t(num_corr_values_iter);
+
+    corr_out_params.num_corr_means_calc = size_t(num_corr_means_calc);
+    corr_out_params.num_corr_means_iterated = size_t(num_corr_means_iter);
+
+    corr_out_params.used_corr_mean_bytes = used_corr_mean_bytes;
+    corr_out_params.accum_corr_mean_bytes = accum_corr_mean_bytes;
+}
+
+// Phase 2 of the `impl_max_weighted_autocorr_of_corr_values` implementation over the correlation values of a storage type.
+//
+template <typename T>
+void calculate_corr_autocorr_values(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrOutParams &                         corr_out_params,
+    const T *                               corr_values_arr,
+    float                                   corr_value_scale,
+    uint64_t                                stream_min_period,
+    uint64_t                                min_offset_shift,
+    uint64_t                                max_offset_shift,
+    uint64_t                                num_offset_shifts,
+    size_t                                  num_autocorr_values,
+    std::vector<SyncseqCorr> &              corr_autocorr_arr)
+{
+    // calculate correlation square values
+    std::vector<float> corr_square_values_arr(num_autocorr_values);
+
+    // calculate correlation denominator accumulated values
+    std::vector<float> corr_denominator_first_accum_value_arr(size_t(num_offset_shifts), 0);
+    std::vector<float> corr_denominator_second_accum_value_arr(size_t(num_offset_shifts), 0);
+
+    for (size_t i = 0; i < num_offset_shifts; i++) {
+        const float corr_value = CorrValueTraits<T>::to_float(corr_values_arr[i], corr_value_scale);
+
+        corr_square_values_arr[i] = corr_value * corr_value;
+    }
+
+    float corr_denominator_first_accum_value = 0;
+    float corr_denominator_second_accum_value = 0;
+
+    for (size_t i = 0; i < num_offset_shifts; i++) {
+        corr_denominator_first_accum_value += corr_square_values_arr[i];
+        corr_denominator_second_accum_value += corr_square_values_arr[size_t(stream_min_period + num_offset_shifts - i - 1)];
+
+        corr_denominator_first_accum_value_arr[size_t(num_offset_shifts - i - 1)] = corr_denominator_first_accum_value;
+        corr_denominator_second_accum_value_arr[size_t(num_offset_shifts - i - 1)] = corr_denominator_second_accum_value;
+    }
+
+    // number of offset shifts (lags) to calculate
+    const uint64_t num_lags = max_offset_shift >= stream_min_period && num_offset_shifts >= min_offset_shift ?
+        (std::min)(max_offset_shift - stream_min_period, num_offset_shifts - min_offset_shift) + 1 : 0;
+
+    // number of correlation values used by all lags
+    const size_t num_lag_values = size_t(stream_min_period + num_offset_shifts);
+
+    // The numerator of a lag is a sum of products of the correlation square values, so all the lags can be calculated by the FFT autocorrelation of the
+    // correlation square values. The number of not zero products is calculated by the autocorrelation of the not zero value flags.
+    //
+    //  Direct loop time complexity:  O(N * L), where N - number of correlation values, L - number of lags
+    //  FFT time complexity:          O(N * ln(N))
+    //
+    std::vector<double> fft_corr_numerator_value_arr;
+    std::vector<double> fft_num_corr_arr;
+
+    bool use_fft = false;
+
+    if (num_lags > 1 && num_lag_values >= corr_in_params.autocorr_fft_min_size) {
+        const uint64_t num_direct_iters = num_lags * num_offset_shifts - num_lags * (num_lags - 1) / 2;
+
+        uint64_t fft_size = 2;
+        uint64_t fft_size_log2 = 1;
+
+        while (fft_size < num_lag_values + stream_min_period + num_lags - 1) {
+            fft_size <<= 1;
+            fft_size_log2++;
+        }
+
+        // 2 transforms of complex values, where a complex butterfly is about 5 times heavier than a direct loop iteration
+        use_fft = num_direct_iters > fft_size * fft_size_log2 * 2 * 5;
+    }
+
+    if (use_fft) {
+        std::vector<double> corr_square_value_arr(num_lag_values);
+        std::vector<double> corr_not_zero_arr(num_lag_values);
+
+        for (size_t i = 0; i < num_lag_values; i++) {
+            const float corr_value = CorrValueTraits<T>::to_float(corr_values_arr[i], corr_value_scale);
+
+            corr_square_value_arr[i] = double(corr_value) * corr_value;
+            corr_not_zero_arr[i] = corr_value ? 1 : 0;
+        }
+
+        const size_t num_fft_lags = size_t(stream_min_period + num_lags);
+
+        fft_corr_numerator_value_arr.resize(num_fft_lags);
+        fft_num_corr_arr.resize(num_fft_lags);
+
+        calculate_fft_autocorr_pair(corr_square_value_arr.data(), corr_not_zero_arr.data(), num_lag_values, num_fft_lags,
+            fft_corr_numerator_value_arr.data(), fft_num_corr_arr.data());
+    }
+
+    // The direct loop is tiled by lags: a tile of `CORR_AUTOCORR_TILE_SIZE` consecutive lags is calculated by a single pass over a block of
+    // correlation values, where the lags are in the vector lanes, and the block is kept in the cache between the tiles of a work item.
+    // The work items of tiles are calculated in parallel.
+    //
+    //  CAUTION:
+    //    The values of a lag are accumulated in the same order as by the not tiled loop, so the result does not depend on the SIMD
+    //    implementation and the number of threads.
+    //
+    std::vector<float> corr_numerator_value_arr;
+    std::vector<uint32_t> num_corr_arr;
+
+    if (!use_fft && num_lags) {
+        std::vector<float> corr_value_arr(num_lag_values);
+
+        for (size_t i = 0; i < num_lag_values; i++) {
+            corr_value_arr[i] = CorrValueTraits<T>::to_float(corr_values_arr[i], corr_value_scale);
+        }
+
+        corr_numerator_value_arr.resize(size_t(num_lags));
+        num_corr_arr.resize(size_t(num_lags));
+
+        const CorrSimdKernels & corr_simd_kernels = get_corr_simd_kernels(corr_in_params.simd_token);
+
+        const float * corr_value_ptr = corr_value_arr.data();
+
+        // the lag index `i` has the offset shift `stream_min_period + i` and the correlation values range `[0; num_offset_shifts - i)`
+        const auto calculate_lag = [&](size_t i, size_t first, size_t last) {
+            const float * shifted_corr_value_ptr = corr_value_ptr + size_t(stream_min_period) + i;
+
+            float corr_numerator_value = corr_numerator_value_arr[i];
+            uint32_t num_corr = num_corr_arr[i];
+
+            for (size_t j = first; j < last; j++) {
+                const float corr_value = corr_value_ptr[j] * shifted_corr_value_ptr[j];
+
+                // count not zero
+                if (corr_value) {
+                    corr_numerator_value += corr_value * corr_value;
+                    num_corr++;
                 }
-                else {
-                    // just search and return a single value instead of sort
+            }
 
-                    auto begin_it = corr_max_weighted_mean_sum_deq.begin();
-                    auto end_it = corr_max_weighted_mean_sum_deq.end();
+            corr_numerator_value_arr[i] = corr_numerator_value;
+            num_corr_arr[i] = num_corr;
+        };
 
-                    // CAUTION:
-                    //  The predicate second argument does remember on return `true`.
-                    //
-                    const SyncseqCorrMean max_corr_mean = *std::max_element(begin_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                    {
-                        // take with lowest period and offset if previous values are equal
-                        return l.corr_mean_sum < r.corr_mean_sum || l.corr_mean_sum == r.corr_mean_sum && (l.offset > r.offset || l.offset == r.offset && l.period > r.period);
-                    });
+        const size_t num_tiles = size_t(num_lags) / CORR_AUTOCORR_TILE_SIZE;
+        const size_t num_tile_items = (num_tiles + CORR_AUTOCORR_TILES_PER_ITEM - 1) / CORR_AUTOCORR_TILES_PER_ITEM;
 
-                    corr_max_weighted_mean_sum_deq.resize(1);
+        // the last item does calculate the rest lags out of the tiles
+        pool.run(num_tile_items + 1, [&](size_t, uint64_t item_index) {
+            if (item_index == num_tile_items) {
+                for (size_t i = num_tiles * CORR_AUTOCORR_TILE_SIZE; i < size_t(num_lags); i++) {
+                    calculate_lag(i, 0, size_t(num_offset_shifts) - i);
+                }
+                return;
+            }
+
+            const size_t first_tile = size_t(item_index) * CORR_AUTOCORR_TILES_PER_ITEM;
+            const size_t last_tile = (std::min)(first_tile + CORR_AUTOCORR_TILES_PER_ITEM, num_tiles);
+
+            // the range of correlation values common for all lags of the item
+            const size_t item_last = size_t(num_offset_shifts) - (last_tile * CORR_AUTOCORR_TILE_SIZE - 1);
 
-                    corr_max_weighted_mean_sum_deq[0] = max_corr_mean;
+            for (size_t block_first = 0; block_first < item_last; block_first += CORR_AUTOCORR_BLOCK_SIZE) {
+                const size_t block_last = (std::min)(block_first + CORR_AUTOCORR_BLOCK_SIZE, item_last);
+
+                for (size_t tile = first_tile; tile < last_tile; tile++) {
+                    const size_t first_lag_index = tile * CORR_AUTOCORR_TILE_SIZE;
+
+                    corr_simd_kernels.calculate_autocorr_tile(corr_value_ptr, size_t(stream_min_period) + first_lag_index, block_first, block_last,
+                        &corr_numerator_value_arr[first_lag_index], &num_corr_arr[first_lag_index]);
                 }
+            }
 
-                end_calc_phase_time(_T("corr weighted means sum"), begin_calc_weighted_means_sum_time, corr_out_params.calc_time_phases);
+            // the rest ranges of tiles and then of lags
+
+            for (size_t tile = first_tile; tile < last_tile; tile++) {
+                const size_t first_lag_index = tile * CORR_AUTOCORR_TILE_SIZE;
+                const size_t tile_last = size_t(num_offset_shifts) - (first_lag_index + CORR_AUTOCORR_TILE_SIZE - 1);
+
+                corr_simd_kernels.calculate_autocorr_tile(corr_value_ptr, size_t(stream_min_period) + first_lag_index, item_last, tile_last,
+                    &corr_numerator_value_arr[first_lag_index], &num_corr_arr[first_lag_index]);
+
+                for (size_t i = first_lag_index; i < first_lag_index + CORR_AUTOCORR_TILE_SIZE; i++) {
+                    calculate_lag(i, tile_last, size_t(num_offset_shifts) - i);
+                }
             }
-            else {
-                const auto begin_calc_max_mean_time = std::chrono::high_resolution_clock::now();
+        });
+    }
 
-                auto begin_it = corr_max_weighted_mean_sum_deq.begin();
-                auto end_it = corr_max_weighted_mean_sum_deq.end();
+    uint64_t num_corr_values_iter = 0;
 
-                if (corr_in_params.return_sorted_result) {
-                    // sort by correlation mean
+    // result of 2 functions multiplication
+    float corr_numerator_value;
 
-                    std::sort(begin_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                    {
-                        return l.corr_mean > r.corr_mean;
-                    });
+    uint32_t num_corr;
 
-                    // sort by offset in a correlation mean
+    for (size_t i = 0, offset_shift = size_t(stream_min_period); max_offset_shift >= offset_shift && num_offset_shifts >= min_offset_shift; i++, offset_shift++, num_offset_shifts--) {
+        auto & autocorr = corr_autocorr_arr[i];
 
-                    size_t step;
+        if (use_fft) {
+            num_corr = uint32_t(std::llround(fft_num_corr_arr[offset_shift]));
 
-                    auto first_it = begin_it;
+            // CAUTION:
+            //  The FFT does return a round off error instead of zero for a lag without not zero products, which can be negative.
+            //
+            corr_numerator_value = num_corr ? float((std::max)(0.0, fft_corr_numerator_value_arr[offset_shift])) : 0;
+        }
+        else {
+            corr_numerator_value = corr_numerator_value_arr[i];
 
-                    auto prev_it = begin_it;
-                    auto next_it = prev_it;
+            num_corr = num_corr_arr[i];
+        }
 
-                    for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                        auto & corr_max_mean_prev_ref = *prev_it;
-                        auto & corr_max_mean_next_ref = *next_it;
+        num_corr_values_iter += num_offset_shifts;
 
-                        if (corr_max_mean_prev_ref.corr_mean != corr_max_mean_next_ref.corr_mean) {
-                            if (step > 1) {
-                                std::sort(first_it, next_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                                {
-                                    return l.offset < r.offset;
-                                });
-                            }
+        // NOTE:
+        //  1. The `num_autocorr_values` here is the entire correlation set normalization factor, because the rest of formula has already normalized to [0; 0.1].
+        //  2. No need to return correlation values back to linear, because they only used for a sort.
+        //  3. A lag without not zero products has zero denominator too.
+        //
+        autocorr.corr_value = num_corr ?
+            std::sqrt(corr_numerator_value * num_autocorr_values * num_autocorr_values / (std::max)(corr_denominator_first_accum_value_arr[i], corr_denominator_second_accum_value_arr[i])) :
+            0;
+        autocorr.num_corr = num_corr;
+    }
 
-                            first_it = next_it;
-                            step = 0;
-                        }
-                    }
+    corr_out_params.num_corr_values_iterated = size_t(num_corr_values_iter);
+}
 
-                    // sort the last
-                    if (step > 1) {
-                        std::sort(first_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                        {
-                            return l.offset < r.offset;
-                        });
-                    }
+// Phase 3 of the `impl_max_weighted_sum_of_corr_mean` implementation.
+//
+void calculate_corr_max_weighted_mean_sums(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrOutParams &                         corr_out_params,
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena)
+{
+    if (corr_max_weighted_mean_sum_arena.empty()) {
+        return;
+    }
+
+    if (!corr_in_params.skip_max_weighted_sum_of_corr_mean_calc) {
+        // Phase 3:
+        //
+        //  Correlation maximum mean (average) values weighted sum calculation, makes groups of offsets grouped with a multiple by a period,
+        //  where groups sorted by offset and then by period in a group. Or in another words does calculate weighted sums of maximal mean values
+        //  in groups calculated for the same offset with a multiple by a period.
+        //
+        //  The output is sorted by maximum mean sum from maximum to minimum, then by offset from minimum to maximum and then by period for an
+        //  offset from minimum to maximum.
+        //
+        //  Helps to resort found offsets and periods to locate more certain values which brings even more stability for false positives.
+        //
+        //  The idea is to put the set of solutions with tolerance-equal mean sums which can be in different order:
+        //
+        //    offset  | period
+        //  ----------+--------
+        //  x         | k
+        //  x         | k * 2
+        //  x         | k * 3
+        //  x         | k * m
+        //  x + k     | k * m
+        //  x + k * 2 | k * m
+        //  x + k * 3 | k * m
+        //  x + k * n | k * m
+        //
+        //  Into sorted order, where x, k, n, m - is a possible minimum.
+        //
+        //  Memory complexity:   O(N) - input, O(N) - output
+        //  Time complexity:     O(N * ln(N))
+        //                         , where N - number of correlation mean values
+        //
+        //  Example:
+        //
+        //   index |   max mean   | num corr |  offset  |  period
+        //  -------+--------------+----------+----------+---------
+        //     1   |    0.850     |    30    |    20    |    33
+        //     2   |    0.845     |     5    |    10    |   200
+        //     3   |    0.841     |    11    |    30    |    90
+        //     4   |    0.836     |    11    |    10    |   100
+        //     5   |    0.831     |     6    |   100    |   165
+        //     6   |    0.823     |    17    |   100    |    55
+        //
+        //  After sort the table above, the result will be:
+        //
+        //         |   max mean   |          |
+        //   index | weighted sum |  offset  |  period
+        //  -------+--------------+----------+---------
+        //     4   |    1.1174    |    10    |   100
+        //     2   |    1.1174    |    10    |   200
+        //     6   |    1.0082    |   100    |    55
+        //     5   |    1.0082    |   100    |   165
+        //     1   |    0.850     |    20    |    33
+        //     3   |    0.841     |    30    |    90
+        //
+        //   , where:
+        //
+        //     1.1174 = 0.836 + 0.845 * (5 - 1) / (11 - 1)
+        //     1.0082 = 0.823 + 0.831 * (6 - 1) / (17 - 1)
+        //
 
-                    // sort by period in an offset
+        const auto begin_calc_weighted_means_sum_time = std::chrono::high_resolution_clock::now();
 
-                    first_it = begin_it;
+        auto & corr_mean_arena = corr_max_weighted_mean_sum_arena;
 
-                    prev_it = begin_it;
-                    next_it = prev_it;
+        const auto & offset_arr = corr_mean_arena.offset_arr;
+        const auto & offset_hi_arr = corr_mean_arena.offset_hi_arr;
+        const auto & period_arr = corr_mean_arena.period_arr;
+        const auto & num_corr_arr = corr_mean_arena.num_corr_arr;
+        const auto & corr_mean_arr = corr_mean_arena.corr_mean_arr;
+        auto & corr_mean_sum_arr = corr_mean_arena.corr_sum_arr;
 
-                    for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                        auto & corr_max_mean_prev_ref = *prev_it;
-                        auto & corr_max_mean_next_ref = *next_it;
+        const size_t end_index = corr_mean_arena.size();
 
-                        if (corr_max_mean_prev_ref.corr_mean != corr_max_mean_next_ref.corr_mean || corr_max_mean_prev_ref.offset != corr_max_mean_next_ref.offset) {
-                            if (step > 1) {
-                                std::sort(first_it, next_it, [&](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                                {
-                                    return l.period < r.period;
-                                });
-                            }
+        size_t first_index;
+        size_t next_index;
 
-                            first_it = next_it;
-                            step = 0;
-                        }
-                    }
+        // sort by offset and then by period in an offset from maximum to minimum
 
-                    // sort the last
-                    if (step > 1) {
-                        std::sort(first_it, end_it, [&](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                        {
-                            return l.period < r.period;
-                        });
-                    }
-                }
-                else {
-                    // just search and return a single value instead of sort
+        radix_sort_corr_mean_arena(pool, corr_mean_arena, [&](size_t i, uint32_t (& key)[4]) {
+            key[0] = ~period_arr[i];
+            key[1] = offset_arr[i];
+            key[2] = corr_mean_arena.is_offset64() ? offset_hi_arr[i] : 0;
+            key[3] = 0;
+        });
 
-                    // CAUTION:
-                    //  The predicate second argument does remember on return `true`.
-                    //
-                    const SyncseqCorrMean max_corr_mean_sum = *std::max_element(begin_it, end_it, [](const SyncseqCorrMean & l, const SyncseqCorrMean & r) -> bool
-                    {
-                        // take with lowest period and offset if previous values are equal
-                        return l.corr_mean < r.corr_mean || l.corr_mean == r.corr_mean && (l.offset > r.offset || l.offset == r.offset && l.period > r.period);
-                    });
+        // Calculate correlation mean weights and mean sums by offset groups in a single pass, O(N) time complexity.
+        //
+        //  The last record of a group has the minimal period, so it accumulates the weighted means of the records with a multiple period,
+        //  which indexes are collected to assign the same mean sum. Other records of a group are reset to the mean value.
+        //
 
-                    corr_max_weighted_mean_sum_deq.resize(1);
+        std::vector<size_t> multiple_period_index_arr;
 
-                    corr_max_weighted_mean_sum_deq[0] = max_corr_mean_sum;
+        for (first_index = 0; first_index != end_index; first_index = next_index) {
+            const uint64_t offset = corr_mean_arena.offset(first_index);
+
+            for (next_index = first_index + 1; next_index != end_index && corr_mean_arena.offset(next_index) == offset; next_index++);
+
+            const size_t min_period_index = next_index - 1;
+            const uint32_t min_period = period_arr[min_period_index];
+
+            float corr_mean_sum = corr_mean_arr[min_period_index];
+
+            multiple_period_index_arr.clear();
+
+            // accumulate mean sum for a minimal period
+            for (size_t i = first_index; i != min_period_index; i++) {
+                if (!(period_arr[i] % min_period)) {
+                    const float corr_mean_weight = corr_mean_arr[i] * (num_corr_arr[i] - 1);
+
+                    corr_mean_sum += corr_mean_weight / (num_corr_arr[min_period_index] - 1);
+
+                    multiple_period_index_arr.push_back(i);
                 }
+                else { // not a multiple by a minimal period, reset to mean value
+                    corr_mean_sum_arr[i] = corr_mean_arr[i];
+                }
+            }
 
-                end_calc_phase_time(_T("corr max mean"), begin_calc_max_mean_time, corr_out_params.calc_time_phases);
+            corr_mean_sum_arr[min_period_index] = corr_mean_sum;
+
+            for (auto multiple_period_index : multiple_period_index_arr) {
+                corr_mean_sum_arr[multiple_period_index] = corr_mean_sum;
             }
         }
-        else if (corr_in_params.impl_token == Impl::impl_min_sum_of_corr_mean_deviat) {
-            const auto begin_calc_phase_mean_deviats_time = std::chrono::high_resolution_clock::now();
 
-            struct CorrOffsetMeanDeviat
+        if (corr_in_params.return_sorted_result) {
+            // sort by correlation mean sum from maximum to minimum, then by offset and then by period in an offset
+
+            radix_sort_corr_mean_arena(pool, corr_mean_arena, [&](size_t i, uint32_t (& key)[4]) {
+                key[0] = period_arr[i];
+                key[1] = offset_arr[i];
+                key[2] = corr_mean_arena.is_offset64() ? offset_hi_arr[i] : 0;
+                key[3] = ~float_to_radix_key(corr_mean_sum_arr[i]);
+            });
+        }
+        else {
+            // just search and return a single value instead of sort
+
+            // CAUTION:
+            //  The predicate second argument does remember on return `true`.
+            //
+            const size_t max_corr_mean_index = max_corr_mean_arena_index(end_index, [&](size_t l, size_t r) -> bool
             {
-                float corr_mean;
-                float corr_mean_deviat_sum;
-                uint32_t num_corr;
-                uint64_t offset;
-            };
+                // take with lowest period and offset if previous values are equal
+                return corr_mean_sum_arr[l] < corr_mean_sum_arr[r] || (corr_mean_sum_arr[l] == corr_mean_sum_arr[r] && (corr_mean_arena.offset(l) > corr_mean_arena.offset(r) || (corr_mean_arena.offset(l) == corr_mean_arena.offset(r) && period_arr[l] > period_arr[r])));
+            });
 
-            uint32_t num_corr_values_iter = 0;
+            const SyncseqCorrMean max_corr_mean = corr_mean_arena[max_corr_mean_index];
 
-            uint32_t num_corr_means_calc = 0;
-            uint32_t num_corr_means_iter = 0;
+            corr_mean_arena.resize(1);
 
-            size_t used_corr_mean_bytes = 0;
-            size_t accum_corr_mean_bytes = 0;
+            corr_mean_arena.set(0, max_corr_mean);
+        }
 
-            float min_corr_mean_value = math::float_max;
-            float max_corr_mean_value = 0;
+        end_calc_phase_time(_T("corr weighted means sum"), begin_calc_weighted_means_sum_time, corr_out_params.calc_time_phases);
+    }
+    else {
+        const auto begin_calc_max_mean_time = std::chrono::high_resolution_clock::now();
 
-            float min_corr_mean_deviat_value = math::float_max;
-            float max_corr_mean_deviat_value = 0;
+        auto & corr_mean_arena = corr_max_weighted_mean_sum_arena;
 
-            CorrOffsetMeanDeviat corr_offset_mean_deviat;
+        const auto & offset_arr = corr_mean_arena.offset_arr;
+        const auto & offset_hi_arr = corr_mean_arena.offset_hi_arr;
+        const auto & period_arr = corr_mean_arena.period_arr;
+        const auto & corr_mean_arr = corr_mean_arena.corr_mean_arr;
 
-            std::vector<CorrOffsetMeanDeviat> corr_min_mean_deviat_sum_per_period; // for single period and different offsets
+        const size_t end_index = corr_mean_arena.size();
 
-            corr_min_mean_deviat_sum_per_period.reserve(corr_in_params.max_corr_values_per_period + 1); // plus one to resize back to maximum if greater
+        if (corr_in_params.return_sorted_result) {
+            // sort by correlation mean from maximum to minimum, then by offset and then by period in an offset
 
-            for (uint64_t period = stream_max_period; period >= stream_min_period; period--) {
-                corr_min_mean_deviat_sum_per_period.clear();
+            radix_sort_corr_mean_arena(pool, corr_mean_arena, [&](size_t i, uint32_t (& key)[4]) {
+                key[0] = period_arr[i];
+                key[1] = offset_arr[i];
+                key[2] = corr_mean_arena.is_offset64() ? offset_hi_arr[i] : 0;
+                key[3] = ~float_to_radix_key(corr_mean_arr[i]);
+            });
+        }
+        else {
+            // just search and return a single value instead of sort
 
-                for (uint64_t i = 0, j = i + period, repeat = 0; i < stream_bit_size - 1; i++, j = i + period, repeat = 0) {
-                    // skip all offsets if number of periods in an offset is greater than maximum
-                    //
-                    if (corr_in_params.max_periods_in_offset != math::uint32_max) {
-                        if (corr_in_params.max_periods_in_offset) {
-                            // including first bit of next period
-                            if (i / period >= corr_in_params.max_periods_in_offset && (i % period)) {
-                                break;
-                            }
-                        }
-                        else {
-                            // excluding first bit of 2d period
-                            if (i / period >= 1) {
-                                break;
-                            }
-                        }
-                    }
+            // CAUTION:
+            //  The predicate second argument does remember on return `true`.
+            //
+            const size_t max_corr_mean_sum_index = max_corr_mean_arena_index(end_index, [&](size_t l, size_t r) -> bool
+            {
+                // take with lowest period and offset if previous values are equal
+                return corr_mean_arr[l] < corr_mean_arr[r] || (corr_mean_arr[l] == corr_mean_arr[r] && (corr_mean_arena.offset(l) > corr_mean_arena.offset(r) || (corr_mean_arena.offset(l) == corr_mean_arena.offset(r) && period_arr[l] > period_arr[r])));
+            });
 
-                    // skip all offsets if the number of left periods if less than minimal value
-                    //
-                    if (syncseq_min_repeat >= (stream_bit_size - i + period - 1) / period) {
-                        break;
-                    }
+            const SyncseqCorrMean max_corr_mean_sum = corr_mean_arena[max_corr_mean_sum_index];
 
-                    const float first_corr_value = corr_values_arr[size_t(i)];
+            corr_mean_arena.resize(1);
 
-                    if (corr_in_params.skip_calc_on_filtered_corr_value_use && !first_corr_value) {
-                        goto skip_calc_on_filtered_corr_value_use_2;
-                    }
+            corr_mean_arena.set(0, max_corr_mean_sum);
+        }
 
-                    corr_offset_mean_deviat = CorrOffsetMeanDeviat{ first_corr_value, 0, first_corr_value ? 1U : 0U, i };
+        end_calc_phase_time(_T("corr max mean"), begin_calc_max_mean_time, corr_out_params.calc_time_phases);
+    }
+}
 
-                    num_corr_values_iter++;
+// Phase 3 of the `impl_min_sum_of_corr_mean_deviat` implementation.
+//
+void calculate_corr_min_mean_deviat_sums(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrOutParams &                         corr_out_params,
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena)
+{
+    if (corr_min_mean_deviat_sum_arena.empty()) {
+        return;
+    }
 
-                    for ( ; j < stream_bit_size && repeat < syncseq_max_repeat; j += period, repeat++) {
-                        const float next_corr_value = corr_values_arr[size_t(j)];
+    const auto begin_calc_min_mean_deviat_time = std::chrono::high_resolution_clock::now();
 
-                        if (corr_in_params.skip_calc_on_filtered_corr_value_use && !next_corr_value) {
-                            goto skip_calc_on_filtered_corr_value_use_2;
-                        }
+    auto & corr_mean_arena = corr_min_mean_deviat_sum_arena;
 
-                        if (next_corr_value) {
-                            corr_offset_mean_deviat.corr_mean += next_corr_value;
-                            corr_offset_mean_deviat.num_corr++;
-                        }
+    const auto & offset_arr = corr_mean_arena.offset_arr;
+    const auto & offset_hi_arr = corr_mean_arena.offset_hi_arr;
+    const auto & period_arr = corr_mean_arena.period_arr;
+    const auto & corr_mean_deviat_sum_arr = corr_mean_arena.corr_sum_arr;
 
-                        num_corr_values_iter++;
-                    }
+    const size_t end_index = corr_mean_arena.size();
+
+    if (corr_in_params.return_sorted_result) {
+        // sort by correlation mean deviation sum from minimum to maximum, then by offset and then by period in an offset
+
+        radix_sort_corr_mean_arena(pool, corr_mean_arena, [&](size_t i, uint32_t (& key)[4]) {
+            key[0] = period_arr[i];
+            key[1] = offset_arr[i];
+            key[2] = corr_mean_arena.is_offset64() ? offset_hi_arr[i] : 0;
+            key[3] = float_to_radix_key(corr_mean_deviat_sum_arr[i]);
+        });
+    }
+    else {
+        // just search and return a single value instead of sort
 
-                    assert(repeat + 1 >= corr_offset_mean_deviat.num_corr);
+        // CAUTION:
+        //  The predicate second argument does remember on return `true`.
+        //
+        const size_t max_corr_mean_deviat_sum_index = max_corr_mean_arena_index(end_index, [&](size_t l, size_t r) -> bool
+        {
+            // take with lowest period and offset if correlation mean deviation sum values are equal
+            return corr_mean_deviat_sum_arr[l] > corr_mean_deviat_sum_arr[r] || (corr_mean_deviat_sum_arr[l] == corr_mean_deviat_sum_arr[r] && (corr_mean_arena.offset(l) > corr_mean_arena.offset(r) || (corr_mean_arena.offset(l) == corr_mean_arena.offset(r) && period_arr[l] > period_arr[r])));
+        });
 
-                    // must be at least 1 repeat
-                    if (corr_offset_mean_deviat.num_corr >= 1 + syncseq_min_repeat) {
-                        corr_offset_mean_deviat.corr_mean /= corr_offset_mean_deviat.num_corr;
+        const SyncseqCorrMeanDeviat max_corr_mean_deviat_sum = corr_mean_arena[max_corr_mean_deviat_sum_index];
 
-                        if (corr_offset_mean_deviat.corr_mean >= corr_in_params.corr_mean_min) {
-                            // calculate deviation sum
+        corr_mean_arena.resize(1);
 
-                            if (first_corr_value) {
-                                const float first_corr_deviat_value = std::fabs(corr_offset_mean_deviat.corr_mean - first_corr_value);
+        corr_mean_arena.set(0, max_corr_mean_deviat_sum);
+    }
 
-                                corr_offset_mean_deviat.corr_mean_deviat_sum += first_corr_deviat_value;
+    end_calc_phase_time(_T("corr min mean deviat"), begin_calc_min_mean_deviat_time, corr_out_params.calc_time_phases);
+}
 
-                                min_corr_mean_deviat_value = (std::min)(min_corr_mean_deviat_value, first_corr_deviat_value);
-                                max_corr_mean_deviat_value = (std::max)(max_corr_mean_deviat_value, first_corr_deviat_value);
-                            }
+// Correlation values calculation state of a synchro sequence.
+//
+struct CorrValuesCalcState
+{
+    const CorrMultiplyTable *       corr_multiply_table_ptr;
+    uint32_t                        syncseq_mask;
+    size_t                          stream_corr_absmax_index;       // index of the state which stream absolute maximums are used, the same for the same synchro sequence bit length
+    CorrValuesBlockParams           corr_values_block_params;
+    uint32_t                        fixed_corr_min;
+    uint32_t                        fixed_filtered_corr_value;
+    CorrValuesBlockStats            corr_values_block_stats;
+    size_t                          num_fixed_corr_values_calc;
+    CorrValues *                    corr_values_ptr;
+};
+
+// Buffer is already padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
+//
+inline uint64_t get_num_corr_values(uint64_t stream_bit_size)
+{
+    const uint64_t padded_stream_bit_size = (stream_bit_size + 31) & ~uint64_t(31);
 
-                            for (j = i + period, repeat = 0; j < stream_bit_size && repeat < syncseq_max_repeat; j += period, repeat++) {
-                                const float next_corr_value = corr_values_arr[size_t(j)];
+    // NOTE:
+    //  The last offset of a stream which bit length is not a multiple of 32 is calculated from the padding too.
+    //
+    return (std::min)(padded_stream_bit_size, stream_bit_size + 1);
+}
 
-                                if (next_corr_value) {
-                                    const float next_corr_deviat_value = std::fabs(corr_offset_mean_deviat.corr_mean - next_corr_value);
+inline void init_corr_values_calc_state(
+    const CorrInParams & corr_in_params, uint32_t syncseq_bytes, const CorrMultiplyTable & corr_multiply_table, size_t stream_corr_absmax_index,
+    uint64_t num_corr_values, CorrValues & corr_values, CorrValuesCalcState & state)
+{
+    const auto syncseq_bit_size = corr_in_params.syncseq_bit_size;
 
-                                    corr_offset_mean_deviat.corr_mean_deviat_sum += next_corr_deviat_value;
+    // Calculate correlation complement functions absolute maximums (by multiply to itself).
+    //
+    // Major time complexity: O(N * M), where N - stream bit length, M - synchro sequence bit length
+    //
 
-                                    min_corr_mean_deviat_value = (std::min)(min_corr_mean_deviat_value, next_corr_deviat_value);
-                                    max_corr_mean_deviat_value = (std::max)(max_corr_mean_deviat_value, next_corr_deviat_value);
-                                }
-                            }
+    // calculate absolute maximums for the synchro sequence bits
+    const float syncseq_corr_absmax = multiply_bits(corr_in_params.corr_mm, syncseq_bytes, syncseq_bytes, syncseq_bit_size);
 
-                            // mean sum of mean deviation
-                            corr_offset_mean_deviat.corr_mean_deviat_sum /= corr_offset_mean_deviat.num_corr;
+    corr_values.corr_value_token = corr_in_params.corr_value_token;
 
-                            if (!corr_in_params.sort_at_first_by_max_corr_mean) {
-                                utils::insert_sorted(corr_min_mean_deviat_sum_per_period, corr_offset_mean_deviat, [](const CorrOffsetMeanDeviat & l, const CorrOffsetMeanDeviat & r) -> bool {
-                                    return l.corr_mean_deviat_sum < r.corr_mean_deviat_sum;
-                                });
-                            }
-                            else {
-                                utils::insert_sorted(corr_min_mean_deviat_sum_per_period, corr_offset_mean_deviat, [](const CorrOffsetMeanDeviat & l, const CorrOffsetMeanDeviat & r) -> bool {
-                                    return l.corr_mean > r.corr_mean;
-                                });
-                            }
+    switch (corr_values.corr_value_token) {
+    case Impl::corr_value_fixed16:
+        corr_values.corr_value_scale = float((std::numeric_limits<uint16_t>::max)());
+        corr_values.fixed16_arr.resize(size_t(num_corr_values));
+        break;
+    case Impl::corr_value_fixed8:
+        corr_values.corr_value_scale = float((std::numeric_limits<uint8_t>::max)());
+        corr_values.fixed8_arr.resize(size_t(num_corr_values));
+        break;
+    default:
+        corr_values.corr_value_token = Impl::corr_value_float32;
+        corr_values.corr_value_scale = 1;
+        corr_values.float32_arr.resize(size_t(num_corr_values));
+    }
 
-                            if (corr_min_mean_deviat_sum_per_period.size() > corr_in_params.max_corr_values_per_period) {
-                                // CAUTION:
-                                //  May lose elements with minimum correlation mean deviation sum if `/sort-at-first-by-max-corr-mean` is defined.
-                                //
-                                corr_min_mean_deviat_sum_per_period.resize(corr_in_params.max_corr_values_per_period);
-                            }
+    const bool use_fixed_corr_values = corr_values.corr_value_token != Impl::corr_value_float32;
 
-                            num_corr_means_calc++;
-                        }
-                    }
+    // CAUTION:
+    //  We must avoid drop to zero before an autocorrelation calculation, because it will randomly distort the being multiplied functions length.
+    //
 
-                    num_corr_means_iter++;
+    const float corr_min = corr_in_params.corr_min;
+    const bool use_linear_corr = corr_in_params.use_linear_corr;
 
-                    if (corr_offset_mean_deviat.corr_mean && corr_offset_mean_deviat.num_corr) {
-                        min_corr_mean_value = (std::min)(min_corr_mean_value, corr_offset_mean_deviat.corr_mean);
-                        max_corr_mean_value = (std::max)(max_corr_mean_value, corr_offset_mean_deviat.corr_mean);
-                    }
+    // a value to replace a correlation value filtered by the correlation minimum
+    const float filtered_corr_value = !corr_in_params.no_zero_corr ?
+        0 : (corr_min ? corr_min : (use_linear_corr ? DEFAULT_LINEAR_CORR_MIN : DEFAULT_QUADRATIC_CORR_MIN));
 
-                skip_calc_on_filtered_corr_value_use_2:;
-                }
+    state.corr_multiply_table_ptr = &corr_multiply_table;
+    state.syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
+    state.stream_corr_absmax_index = stream_corr_absmax_index;
+
+    // NOTE:
+    //  The fixed point correlation values are filtered after the conversion in the integer domain, so the kernels must not filter.
+    //
+    state.corr_values_block_params = CorrValuesBlockParams{
+        syncseq_corr_absmax,
+        !use_fixed_corr_values ? corr_min : 0,
+        !use_fixed_corr_values ? filtered_corr_value : 0,
+        use_linear_corr
+    };
+
+    state.fixed_corr_min = quantize_corr_value(corr_min, corr_values.corr_value_scale);
+    state.fixed_filtered_corr_value = quantize_corr_value(filtered_corr_value, corr_values.corr_value_scale);
+
+    state.corr_values_block_stats = CorrValuesBlockStats{ math::float_max, 0, 0 };
+    state.num_fixed_corr_values_calc = 0;
+    state.corr_values_ptr = &corr_values;
+}
+
+// Calculates absolute maximums for the bit stream together with correlation values of each synchro sequence.
+//
+//  The stream is processed by blocks of consecutive offsets in a single pass, where the stream absolute maximums and the multiplied values
+//  of a block are calculated at first into local arrays and only after that are converted and filtered, so the conversion loop does not
+//  interleave with the table lookups, has no branches and the stream absolute maximums are never stored for the whole stream.
+//
+//  In case of multiple synchro sequences a stream block is loaded once for all the synchro sequences and the stream absolute maximums of a block
+//  are calculated once for all the synchro sequences of the same bit length.
+//
+// Major time complexity: O(N * M / 8) table lookups, where N - stream bit length, M - synchro sequence bit length
+//
+inline void calculate_corr_values_blocks(
+    const CorrSimdKernels & corr_simd_kernels, const uint32_t * stream_buf32, uint64_t num_corr_values, CorrValuesCalcState * state_arr, size_t num_states)
+{
+    std::vector<float> stream_corr_absmax_arr(num_states * CORR_BLOCK_BIT_SIZE);
+
+    float multiplied_values_arr[CORR_BLOCK_BIT_SIZE];
+    float corr_values_block_arr[CORR_BLOCK_BIT_SIZE];
+
+    for (uint64_t block_offset = 0; block_offset < num_corr_values; block_offset += CORR_BLOCK_BIT_SIZE) {
+        const size_t block_size = size_t((std::min)(uint64_t(CORR_BLOCK_BIT_SIZE), num_corr_values - block_offset));
+
+        const uint32_t * stream_block_buf32 = stream_buf32 + block_offset / 32;
+
+        for (size_t i = 0; i < num_states; i++) {
+            CorrValuesCalcState & state = state_arr[i];
+            CorrValues & corr_values = *state.corr_values_ptr;
+
+            const CorrMultiplyTable & corr_multiply_table = *state.corr_multiply_table_ptr;
+
+            float * stream_corr_absmax_block_arr = stream_corr_absmax_arr.data() + state.stream_corr_absmax_index * CORR_BLOCK_BIT_SIZE;
+
+            if (state.stream_corr_absmax_index == i) {
+                corr_simd_kernels.multiply_bits_block(corr_multiply_table.stream_arr, stream_block_buf32, state.syncseq_mask, block_size, stream_corr_absmax_block_arr);
+            }
+
+            corr_simd_kernels.multiply_bits_block(corr_multiply_table.syncseq_arr, stream_block_buf32, state.syncseq_mask, block_size, multiplied_values_arr);
+
+            switch (corr_values.corr_value_token) {
+            case Impl::corr_value_fixed16:
+                corr_simd_kernels.calculate_corr_values_block(state.corr_values_block_params, multiplied_values_arr, stream_corr_absmax_block_arr, block_size,
+                    corr_values_block_arr, state.corr_values_block_stats);
+                quantize_corr_values_block(corr_values_block_arr, block_size, corr_values.corr_value_scale, state.fixed_corr_min, state.fixed_filtered_corr_value,
+                    corr_values.fixed16_arr.data() + size_t(block_offset), state.num_fixed_corr_values_calc);
+                break;
+            case Impl::corr_value_fixed8:
+                corr_simd_kernels.calculate_corr_values_block(state.corr_values_block_params, multiplied_values_arr, stream_corr_absmax_block_arr, block_size,
+                    corr_values_block_arr, state.corr_values_block_stats);
+                quantize_corr_values_block(corr_values_block_arr, block_size, corr_values.corr_value_scale, state.fixed_corr_min, state.fixed_filtered_corr_value,
+                    corr_values.fixed8_arr.data() + size_t(block_offset), state.num_fixed_corr_values_calc);
+                break;
+            default:
+                corr_simd_kernels.calculate_corr_values_block(state.corr_values_block_params, multiplied_values_arr, stream_corr_absmax_block_arr, block_size,
+                    corr_values.float32_arr.data() + size_t(block_offset), state.corr_values_block_stats);
+            }
+        }
+    }
+}
+
+inline void finish_corr_values_calc_state(const CorrValuesCalcState & state, CorrOutParams & corr_out_params)
+{
+    const bool use_fixed_corr_values = state.corr_values_ptr->corr_value_token != Impl::corr_value_float32;
+
+    corr_out_params.num_corr_values_calc = !use_fixed_corr_values ? state.corr_values_block_stats.num_corr_values_calc : state.num_fixed_corr_values_calc;
+
+    corr_out_params.min_corr_value = state.corr_values_block_stats.min_corr_value;
+    corr_out_params.max_corr_value = state.corr_values_block_stats.max_corr_value;
+}
+
+// The correlation values are already calculated if the stream buffer is null.
+//
+void calculate_syncseq_correlation_impl(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrInOutParams &                       corr_io_params,
+    CorrOutParams &                         corr_out_params,
+    const uint8_t *                         stream_buf,
+    CorrValues &                            corr_values,
+    std::vector<SyncseqCorr> &              corr_autocorr_arr,
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena,
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena)
+{
+    // Old classic xor algorithm:
+    //
+    //  Search synchro sequence in a bit stream by sequential 32-bit blocks compare as shifted 64-bit blocks.
+    //  Formula for all comparisons (K) of N 32-bit blocks in a stream:
+    //    If N-even => K = ((N + 1) * N / 2 - 1) * 32
+    //    If N-odd  => K = ((N + 1) / 2 * N - 1) * 32
+    //
+    // New algorithm does not use xor. Instead it does use 2 functions multiplication to calculate correlation.
+    // The main difference is that the xor algorithm does not resistant to the input noise, when the correlation algorithm can be modified to gain that ability.
+    //
+
+    const auto begin_calc_time = std::chrono::high_resolution_clock::now();
+
+    // the time of the already calculated correlation values is included into the whole time
+    double calc_corr_values_time_sec = 0;
+
+    for (const auto & calc_time_phase : corr_out_params.calc_time_phases) {
+        calc_corr_values_time_sec += calc_time_phase.calc_time_dur_sec;
+    }
+
+    corr_out_params.calc_time_phases.reserve(5);
+
+    BOOST_SCOPE_EXIT(&corr_out_params, begin_calc_time, calc_corr_values_time_sec) {
+        end_calc_phase_time(_T("all"), begin_calc_time, corr_out_params.calc_time_phases);
+
+        CalcTimePhase & calc_all_time_phase = corr_out_params.calc_time_phases.back();
+
+        calc_all_time_phase.calc_time_dur_sec += calc_corr_values_time_sec;
+
+        calc_phase_time_fractions(calc_all_time_phase.calc_time_dur_sec, corr_out_params.calc_time_phases);
+    } BOOST_SCOPE_EXIT_END;
+
+    const auto stream_bit_size = corr_in_params.stream_bit_size;
+    const auto syncseq_bit_size = corr_in_params.syncseq_bit_size;
+
+    const auto syncseq_int32 = corr_io_params.syncseq_int32;
+    const uint32_t syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
+    const uint32_t syncseq_bytes = syncseq_int32 & syncseq_mask;
+
+    // write back
+    corr_io_params.syncseq_int32 = syncseq_bytes;
+
+    assert(stream_bit_size);
+    assert(syncseq_bit_size);
+    assert(syncseq_bit_size < stream_bit_size); // must be greater
+
+    // Recalculate the maximum repeats from the minimum repeats, because number of minimum repeats has a priority.
+    //
+    const auto syncseq_min_repeat = corr_in_params.period_min_repeat ? corr_in_params.period_min_repeat : 1;
+    const auto syncseq_max_repeat = (std::max)(corr_in_params.period_max_repeat, syncseq_min_repeat);
+
+    uint64_t stream_min_period =
+        (std::min)(
+            // If not defined, then minimal "from" period is at least 2 synchro sequence bit length, otherwise - not less than synchro sequence bit length + 1.
+            // But always not greater than a bit stream length - 1.
+            uint64_t(corr_in_params.min_period ? (std::max)(syncseq_bit_size + 1, corr_in_params.min_period) : syncseq_bit_size * 2),
+            stream_bit_size - 1);
+    uint64_t stream_max_period =
+        (std::min)(
+            // If not defined, then minimal "to" period is at least 2 synchro sequence bit length, otherwise - not less than synchro sequence bit length + 1.
+            // But always not greater than a bit stream length - 1.
+            uint64_t(corr_in_params.max_period != math::uint32_max ? (std::max)(syncseq_bit_size + 1, corr_in_params.max_period) : stream_bit_size * 2),
+            stream_bit_size - 1);
+
+    // align maximum period by minimum period
+    stream_max_period = (std::max)(stream_max_period, stream_min_period);
 
-                for (const auto & corr_min_mean_deviat : corr_min_mean_deviat_sum_per_period) {
-                    corr_min_mean_deviat_sum_deq.push_back(SyncseqCorrMeanDeviat{
-                        uint32_t(corr_min_mean_deviat.offset), uint32_t(period), corr_min_mean_deviat.num_corr, corr_min_mean_deviat.corr_mean, corr_min_mean_deviat.corr_mean_deviat_sum
-                    });
-                }
+    // Recalculate min/max periods from the minimum repeat, because number of minimum repeats has priority over a period.
+    //
+    const uint64_t stream_max_period_for_min_repeat = (stream_bit_size - 1) / (syncseq_min_repeat ? syncseq_min_repeat : 1);
 
-                used_corr_mean_bytes = (std::max)(used_corr_mean_bytes, corr_min_mean_deviat_sum_deq.size() * sizeof(corr_min_mean_deviat_sum_deq[0]));
-                accum_corr_mean_bytes = (std::max)(accum_corr_mean_bytes, corr_min_mean_deviat_sum_deq.size() * sizeof(corr_min_mean_deviat_sum_deq[0]));
+    stream_min_period = (std::min)(stream_min_period, stream_max_period_for_min_repeat);
+    stream_max_period = (std::min)(stream_max_period, stream_max_period_for_min_repeat);
 
-                if (accum_corr_mean_bytes >= corr_in_params.max_corr_mean_bytes) {
-                    // out of buffer, cancel calculation
-                    corr_out_params.accum_corr_mean_quit = true;
-                    break;
-                }
-            }
+    // just in case
+    stream_min_period = (std::min)(stream_min_period, uint64_t(math::uint32_max));
+    stream_max_period = (std::min)(stream_max_period, uint64_t(math::uint32_max));
 
-            end_calc_phase_time(_T("corr mean deviat values"), begin_calc_phase_mean_deviats_time, corr_out_params.calc_time_phases);
+    assert(stream_min_period);
 
-            corr_out_params.min_corr_mean = min_corr_mean_value;
-            corr_out_params.max_corr_mean = max_corr_mean_value;
+    // CAUTION:
+    //  Input conditions must be initially in consistency between each other and must not decrease the field of search of the result because of mutual inconsistency.
+    //
 
-            corr_out_params.min_corr_mean_deviat = min_corr_mean_deviat_value;
-            corr_out_params.max_corr_mean_deviat = max_corr_mean_deviat_value;
+    // write back for user notification
+    corr_out_params.min_period = uint32_t(stream_min_period);
+    corr_out_params.max_period = uint32_t(stream_max_period);
 
-            corr_out_params.num_corr_values_iterated = num_corr_values_iter;
+    if (corr_in_params.min_period && corr_in_params.min_period != math::uint32_max && corr_in_params.min_period < stream_min_period) {
+        // recalculated minimum period is increased, important input condition is changed and reduced the field of search of the result, quit calculation
+        corr_out_params.input_inconsistency = true;
+        return;
+    }
 
-            corr_out_params.num_corr_means_calc = num_corr_means_calc;
-            corr_out_params.num_corr_means_iterated = num_corr_means_iter;
+    if (corr_in_params.max_period != math::uint32_max && stream_max_period < corr_in_params.max_period) {
+        // recalculated maximum period is decreased, important input condition is changed and reduced the field of search of the result, quit calculation
+        corr_out_params.input_inconsistency = true;
+        return;
+    }
 
-            corr_out_params.used_corr_mean_bytes = used_corr_mean_bytes;
-            corr_out_params.accum_corr_mean_bytes = accum_corr_mean_bytes;
+    if (corr_in_params.period_min_repeat && stream_max_period * corr_in_params.period_min_repeat >= stream_bit_size) {
+        // recalculated stream bit size is increased, important input condition is changed and reduced the field of search of the result, quit calculation
+        corr_out_params.input_inconsistency = true;
+        return;
+    }
 
-            const auto corr_min_mean_deviat_sum_deq_size = corr_min_mean_deviat_sum_deq.size();
+    assert(stream_max_period * syncseq_min_repeat < stream_bit_size);
 
-            if (!corr_min_mean_deviat_sum_deq_size) {
-                break;
-            }
+    if (syncseq_bit_size >= stream_min_period) {
+        // the input conditions are not met, not enough room for calculation
+        corr_out_params.input_inconsistency = true;
+        return;
+    }
 
-            const auto begin_calc_min_mean_deviat_time = std::chrono::high_resolution_clock::now();
+    const uint64_t num_corr_values = get_num_corr_values(stream_bit_size);
 
-            auto begin_it = corr_min_mean_deviat_sum_deq.begin();
-            auto end_it = corr_min_mean_deviat_sum_deq.end();
+    // Phase 1:
+    //
+    //  Correlation values calculation, creates a moderate but still instable algorithm certainty or false positive stability within input noise.
+    //
+    // Produces correlation values with noticeable certainty tolerance around 33% from the math expected value of number `one` bits per synchro sequence length,
+    // where math expected value is equal to the half of synchro sequence length.
+    // For example, if synchro sequence has 20 bits length, then algorithm would output uncertain correlation values after a value greater than 33% of noised
+    // bits of 10 bits, i.e. greater than ~3 noised bits per each 20 bits in a bit stream.
+    //
+    //  Note:
+    //    Even if the algorithm has a complete instability for not false positive output if over a tolerance, but nonetheless that does not mean it is
+    //    stable enough below the tolerance. To increase the noise tolerance and gain more stability below the tolerance you must use the second phase algorithm.
+    //
+    // Memory complexity:   O(N * M) - to generate complement functions, O(N) - to calculate correlation values
+    // Time complexity:     O(N * M)
+    //                        , where N - stream bit length, M - synchro sequence bit length
+    //
 
-            if (corr_in_params.return_sorted_result) {
-                // sort by correlation mean deviation sum
+    // the correlation values can be already calculated for multiple synchro sequences by a single pass
+    if (stream_buf) {
+        const auto begin_calc_phase_time = std::chrono::high_resolution_clock::now();
 
-                std::sort(begin_it, end_it, [](const SyncseqCorrMeanDeviat & l, const SyncseqCorrMeanDeviat & r) -> bool
-                {
-                    return l.corr_mean_deviat_sum < r.corr_mean_deviat_sum;
-                });
+        // NOTE:
+        //  The synchro sequence is fixed for the whole calculation, so all the bits multiplication can be precalculated per block byte and
+        //  replaced by table lookups.
+        //
+        std::unique_ptr<CorrMultiplyTable> corr_multiply_table_ptr{ new CorrMultiplyTable };
 
-                // sort by offset in a correlation mean deviation sum
+        make_corr_multiply_table(corr_in_params.corr_mm, syncseq_bytes, syncseq_bit_size, *corr_multiply_table_ptr);
 
-                size_t step = 0;
+        CorrValuesCalcState corr_values_calc_state;
 
-                auto first_it = begin_it;
+        init_corr_values_calc_state(corr_in_params, syncseq_bytes, *corr_multiply_table_ptr, 0, num_corr_values, corr_values, corr_values_calc_state);
 
-                auto prev_it = begin_it;
-                auto next_it = prev_it;
+        calculate_corr_values_blocks(get_corr_simd_kernels(corr_in_params.simd_token), (const uint32_t *)stream_buf, num_corr_values, &corr_values_calc_state, 1);
 
-                for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                    auto & corr_max_mean_prev_ref = *prev_it;
-                    auto & corr_max_mean_next_ref = *next_it;
+        end_calc_phase_time(_T("corr values"), begin_calc_phase_time, corr_out_params.calc_time_phases);
 
-                    if (corr_max_mean_prev_ref.corr_mean_deviat_sum != corr_max_mean_next_ref.corr_mean_deviat_sum) {
-                        if (step > 1) {
-                            std::sort(first_it, next_it, [](const SyncseqCorrMeanDeviat & l, const SyncseqCorrMeanDeviat & r) -> bool
-                            {
-                                return l.offset < r.offset;
-                            });
-                        }
+        finish_corr_values_calc_state(corr_values_calc_state, corr_out_params);
+    }
 
-                        first_it = next_it;
-                        step = 0;
-                    }
-                }
+    switch (corr_in_params.impl_token) {
+    case Impl::impl_max_weighted_sum_of_corr_mean:
+    case Impl::impl_min_sum_of_corr_mean_deviat:
+    case Impl::impl_ensemble_of_corr_mean:
+    {
+        // Phase 2:
+        //
+        //  Correlation mean (average) values calculation, significantly increases algorithm certainty or false positive stability within input noise.
+        //
+        // Produces correlation mean values with noticeable certainty tolerance around 66% from the math expected value of number `one` bits per synchro sequence length,
+        // where math expected value is equal to the half of synchro sequence length.
+        // For example, if synchro sequence has 20 bits length, then algorithm would output uncertain correlation mean values after a value greater than 66% of noised
+        // bits of 10 bits, i.e. greater than ~6 noised bits per each 20 bits in a bit stream.
+        //
+        //  Note:
+        //    Even if the algorithm has a complete instability for not false positive output if over a tolerance, but nonetheless that does not mean it has
+        //    100% stability below the tolerance. In other words the algorithm just has no noted instability for not false positive output below the tolerance.
+        //    But still sometimes it happens to be instable below but near the tolerance.
+        //
+        // Float memory complexity:     from O(N) to O(N * N * ln(N)),
+        //                                depends on options, in approximation ~ O(N) for `/corr-mean-min 0.81`, `/max-corr-values-per-period <N>` and other options is default.
+        //                                If `/max-corr-values-per-period <K>`, then memory complexity reduces down to `O(N * K * ln(N))`.
+        // Major Time complexity:       O(N * N * ln(N))
+        //                                , where N - stream bit length, K < N
+        //
 
-                // sort the last
-                if (step > 1) {
-                    std::sort(first_it, end_it, [](const SyncseqCorrMeanDeviat & l, const SyncseqCorrMeanDeviat & r) -> bool
-                    {
-                        return l.offset < r.offset;
-                    });
-                }
+        corr_out_params.accum_corr_mean_calc = true;
 
-                // sort by period in an offset
+        // CAUTION:
+        //  The correlation values array (`corr_values`) can has 0's values because values can be filtered out by the correlation minimum value.
+        //  What means we must skip usage of these values.
+        //
 
-                first_it = begin_it;
+        // NOTE:
+        //  The periods are calculated in parallel by the pool of workers, but the results are merged strictly in the order of periods,
+        //  so the result does not depend on the number of workers.
+        //
 
-                prev_it = begin_it;
-                next_it = prev_it;
+        if (corr_in_params.impl_token == Impl::impl_max_weighted_sum_of_corr_mean) {
+            const auto begin_calc_phase_means_time = std::chrono::high_resolution_clock::now();
 
-                for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                    auto & corr_max_mean_prev_ref = *prev_it;
-                    auto & corr_max_mean_next_ref = *next_it;
+            switch (corr_values.corr_value_token) {
+            case Impl::corr_value_fixed16:
+                calculate_corr_mean_values(pool, corr_in_params, corr_out_params, corr_values.fixed16_arr.data(), corr_values.corr_value_scale,
+                    stream_bit_size, stream_min_period, stream_max_period, syncseq_min_repeat, syncseq_max_repeat, corr_max_weighted_mean_sum_arena);
+                break;
+            case Impl::corr_value_fixed8:
+                calculate_corr_mean_values(pool, corr_in_params, corr_out_params, corr_values.fixed8_arr.data(), corr_values.corr_value_scale,
+                    stream_bit_size, stream_min_period, stream_max_period, syncseq_min_repeat, syncseq_max_repeat, corr_max_weighted_mean_sum_arena);
+                break;
+            default:
+                calculate_corr_mean_values(pool, corr_in_params, corr_out_params, corr_values.float32_arr.data(), corr_values.corr_value_scale,
+                    stream_bit_size, stream_min_period, stream_max_period, syncseq_min_repeat, syncseq_max_repeat, corr_max_weighted_mean_sum_arena);
+            }
 
-                    if (corr_max_mean_prev_ref.corr_mean_deviat_sum != corr_max_mean_next_ref.corr_mean_deviat_sum || corr_max_mean_prev_ref.offset != corr_max_mean_next_ref.offset) {
-                        if (step > 1) {
-                            std::sort(first_it, next_it, [&](const SyncseqCorrMeanDeviat & l, const SyncseqCorrMeanDeviat & r) -> bool
-                            {
-                                return l.period < r.period;
-                            });
-                        }
+            end_calc_phase_time(_T("corr mean values"), begin_calc_phase_means_time, corr_out_params.calc_time_phases);
+        }
+        else {
+            const auto begin_calc_phase_mean_deviats_time = std::chrono::high_resolution_clock::now();
 
-                        first_it = next_it;
-                        step = 0;
-                    }
-                }
+            // the ensemble does calculate the correlation mean values of both implementations in the same pass
+            SyncseqCorrMeanSoA * corr_max_weighted_mean_sum_arena_ptr =
+                corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean ? &corr_max_weighted_mean_sum_arena : nullptr;
 
-                // sort the last
-                if (step > 1) {
-                    std::sort(first_it, end_it, [&](const SyncseqCorrMeanDeviat & l, const SyncseqCorrMeanDeviat & r) -> bool
-                    {
-                        return l.period < r.period;
-                    });
-                }
+            switch (corr_values.corr_value_token) {
+            case Impl::corr_value_fixed16:
+                calculate_corr_mean_deviat_values(pool, corr_in_params, corr_out_params, corr_values.fixed16_arr.data(), corr_values.corr_value_scale,
+                    stream_bit_size, stream_min_period, stream_max_period, syncseq_min_repeat, syncseq_max_repeat, corr_min_mean_deviat_sum_arena,
+                    corr_max_weighted_mean_sum_arena_ptr);
+                break;
+            case Impl::corr_value_fixed8:
+                calculate_corr_mean_deviat_values(pool, corr_in_params, corr_out_params, corr_values.fixed8_arr.data(), corr_values.corr_value_scale,
+                    stream_bit_size, stream_min_period, stream_max_period, syncseq_min_repeat, syncseq_max_repeat, corr_min_mean_deviat_sum_arena,
+                    corr_max_weighted_mean_sum_arena_ptr);
+                break;
+            default:
+                calculate_corr_mean_deviat_values(pool, corr_in_params, corr_out_params, corr_values.float32_arr.data(), corr_values.corr_value_scale,
+                    stream_bit_size, stream_min_period, stream_max_period, syncseq_min_repeat, syncseq_max_repeat, corr_min_mean_deviat_sum_arena,
+                    corr_max_weighted_mean_sum_arena_ptr);
             }
-            else {
-                // just search and return a single value instead of sort
-
-                // CAUTION:
-                //  The predicate second argument does remember on return `true`.
-                //
-                const SyncseqCorrMeanDeviat max_corr_mean_deviat_sum = *std::max_element(begin_it, end_it, [](const SyncseqCorrMeanDeviat & l, const SyncseqCorrMeanDeviat & r) -> bool
-                {
-                    // take with lowest period and offset if correlation mean deviation sum values are equal
-                    return l.corr_mean_deviat_sum > r.corr_mean_deviat_sum || l.corr_mean_deviat_sum == r.corr_mean_deviat_sum && (l.offset > r.offset || l.offset == r.offset && l.period > r.period);
-                });
 
-                corr_min_mean_deviat_sum_deq.resize(1);
+            end_calc_phase_time(corr_max_weighted_mean_sum_arena_ptr ? _T("corr mean ensemble values") : _T("corr mean deviat values"),
+                begin_calc_phase_mean_deviats_time, corr_out_params.calc_time_phases);
+        }
 
-                corr_min_mean_deviat_sum_deq[0] = max_corr_mean_deviat_sum;
-            }
+        // CAUTION:
+        //  A correlation mean result is sorted by a 32-bit index.
+        //
+        if (corr_max_weighted_mean_sum_arena.size() > math::uint32_max || corr_min_mean_deviat_sum_arena.size() > math::uint32_max) {
+            // the results are out of the sort index range, quit calculation
+            corr_out_params.input_inconsistency = true;
+            return;
+        }
+
+        if (corr_in_params.impl_token != Impl::impl_min_sum_of_corr_mean_deviat) {
+            calculate_corr_max_weighted_mean_sums(pool, corr_in_params, corr_out_params, corr_max_weighted_mean_sum_arena);
+        }
 
-            end_calc_phase_time(_T("corr min mean deviat"), begin_calc_min_mean_deviat_time, corr_out_params.calc_time_phases);
+        if (corr_in_params.impl_token != Impl::impl_max_weighted_sum_of_corr_mean) {
+            calculate_corr_min_mean_deviat_sums(pool, corr_in_params, corr_out_params, corr_min_mean_deviat_sum_arena);
         }
     } break;
 
@@ -1540,6 +2227,15 @@ void calculate_syncseq_correlation(
             }
         }
 
+        // CAUTION:
+        //  An autocorrelation lag is returned as a 32-bit period and is sorted by a 32-bit index.
+        //
+        if (stream_min_period + num_offset_shifts - 1 > math::uint32_max) {
+            // the lags are out of the period range, quit calculation
+            corr_out_params.input_inconsistency = true;
+            return;
+        }
+
         const auto num_autocorr_values = size_t(min_offset_shift + num_offset_shifts);
         //const auto num_syncseq_autocorr_values = size_t((min_offset_shift + num_offset_shifts) * syncseq_bit_size);
         //const auto num_syncseq_offset_shifts = size_t(num_offset_shifts * syncseq_bit_size);
@@ -1550,143 +2246,54 @@ void calculate_syncseq_correlation(
             corr_autocorr_arr.push_back(SyncseqCorr{ 0, uint32_t(stream_min_period + i), 0, 0 });
         }
 
-        // calculate correlation square values
-        std::vector<float> corr_square_values_arr(num_autocorr_values);
-
-        // calculate correlation denominator accumulated values
-        std::vector<float> corr_denominator_first_accum_value_arr(size_t(num_offset_shifts), 0);
-        std::vector<float> corr_denominator_second_accum_value_arr(size_t(num_offset_shifts), 0);
-
-        for (size_t i = 0; i < num_offset_shifts; i++) {
-            const auto & corr_value = corr_values_arr[i];
-
-            corr_square_values_arr[i] = corr_value * corr_value;
-        }
-
-        float corr_denominator_first_accum_value = 0;
-        float corr_denominator_second_accum_value = 0;
-
-        for (size_t i = 0; i < num_offset_shifts; i++) {
-            corr_denominator_first_accum_value += corr_square_values_arr[i];
-            corr_denominator_second_accum_value += corr_square_values_arr[size_t(stream_min_period + num_offset_shifts - i - 1)];
-
-            corr_denominator_first_accum_value_arr[size_t(num_offset_shifts - i - 1)] = corr_denominator_first_accum_value;
-            corr_denominator_second_accum_value_arr[size_t(num_offset_shifts - i - 1)] = corr_denominator_second_accum_value;
-        }
-
-        uint32_t num_corr_values_iter = 0;
-
-        // result of 2 functions multiplication
-        float corr_numerator_value;
-
-        uint32_t num_corr;
-
-        for (size_t i = 0, offset_shift = size_t(stream_min_period); max_offset_shift >= offset_shift && num_offset_shifts >= min_offset_shift; i++, offset_shift++, num_offset_shifts--) {
-            auto & autocorr = corr_autocorr_arr[i];
-
-            // result of 2 functions multiplication
-            corr_numerator_value = 0;
-
-            num_corr = 0;
-
-            for (size_t j = 0; j < num_offset_shifts; j++) {
-                const float corr_value =  corr_values_arr[j] * corr_values_arr[j + offset_shift];
-
-                // count not zero
-                if (corr_value) {
-                    corr_numerator_value += corr_value * corr_value;
-                    num_corr++;
-                }
-
-                num_corr_values_iter++;
-            }
-
-            // NOTE:
-            //  1. The `num_autocorr_values` here is the entire correlation set normalization factor, because the rest of formula has already normalized to [0; 0.1].
-            //  2. No need to return correlation values back to linear, because they only used for a sort.
-            //
-            autocorr.corr_value = std::sqrt(corr_numerator_value * num_autocorr_values * num_autocorr_values / (std::max)(corr_denominator_first_accum_value_arr[i], corr_denominator_second_accum_value_arr[i]));
-            autocorr.num_corr = num_corr;
+        switch (corr_values.corr_value_token) {
+        case Impl::corr_value_fixed16:
+            calculate_corr_autocorr_values(pool, corr_in_params, corr_out_params, corr_values.fixed16_arr.data(), corr_values.corr_value_scale,
+                stream_min_period, min_offset_shift, max_offset_shift, num_offset_shifts, num_autocorr_values, corr_autocorr_arr);
+            break;
+        case Impl::corr_value_fixed8:
+            calculate_corr_autocorr_values(pool, corr_in_params, corr_out_params, corr_values.fixed8_arr.data(), corr_values.corr_value_scale,
+                stream_min_period, min_offset_shift, max_offset_shift, num_offset_shifts, num_autocorr_values, corr_autocorr_arr);
+            break;
+        default:
+            calculate_corr_autocorr_values(pool, corr_in_params, corr_out_params, corr_values.float32_arr.data(), corr_values.corr_value_scale,
+                stream_min_period, min_offset_shift, max_offset_shift, num_offset_shifts, num_autocorr_values, corr_autocorr_arr);
         }
 
-        corr_out_params.num_corr_values_iterated = num_corr_values_iter;
-
         auto begin_it = corr_autocorr_arr.begin();
         auto end_it = corr_autocorr_arr.end();
 
         if (corr_in_params.return_sorted_result) {
-            // sort by correlation values
-
-            std::sort(begin_it, end_it, [](const SyncseqCorr & l, const SyncseqCorr & r) -> bool
-            {
-                return l.corr_value > r.corr_value;
-            });
-
-            // sort by offset in a correlation value
-
-            size_t step;
+            // sort by correlation value from maximum to minimum, then by offset and then by period in an offset
 
-            auto first_it = begin_it;
+            const size_t num_autocorrs = corr_autocorr_arr.size();
 
-            auto prev_it = begin_it;
-            auto next_it = prev_it;
+            std::vector<RadixSortKey> key_arr(num_autocorrs);
+            std::vector<RadixSortKey> buf_arr;
 
-            for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                auto & corr_max_mean_prev_ref = *prev_it;
-                auto & corr_max_mean_next_ref = *next_it;
-
-                if (corr_max_mean_prev_ref.corr_value != corr_max_mean_next_ref.corr_value) {
-                    if (step > 1) {
-                        std::sort(first_it, next_it, [](const SyncseqCorr & l, const SyncseqCorr & r) -> bool
-                        {
-                            return l.offset < r.offset;
-                        });
-                    }
-
-                    first_it = next_it;
-                    step = 0;
-                }
-            }
+            for (size_t i = 0; i < num_autocorrs; i++) {
+                const SyncseqCorr & corr_autocorr_ref = corr_autocorr_arr[i];
 
-            // sort the last
-            if (step > 1) {
-                std::sort(first_it, end_it, [](const SyncseqCorr & l, const SyncseqCorr & r) -> bool
-                {
-                    return l.offset < r.offset;
-                });
+                key_arr[i] = RadixSortKey{
+                    {
+                        corr_autocorr_ref.period, uint32_t(corr_autocorr_ref.offset), uint32_t(corr_autocorr_ref.offset >> 32),
+                        ~float_to_radix_key(corr_autocorr_ref.corr_value)
+                    },
+                    uint32_t(i)
+                };
             }
 
-            // sort by period in an offset
-
-            first_it = begin_it;
+            radix_sort(pool, key_arr, buf_arr);
 
-            prev_it = begin_it;
-            next_it = prev_it;
+            std::vector<SyncseqCorr> sorted_corr_autocorr_arr;
 
-            for (step = 0, next_it++; next_it != end_it; step++, prev_it = next_it, next_it++) {
-                auto & corr_max_mean_prev_ref = *prev_it;
-                auto & corr_max_mean_next_ref = *next_it;
+            sorted_corr_autocorr_arr.reserve(num_autocorrs);
 
-                if (corr_max_mean_prev_ref.corr_value != corr_max_mean_next_ref.corr_value || corr_max_mean_prev_ref.offset != corr_max_mean_next_ref.offset) {
-                    if (step > 1) {
-                        std::sort(first_it, next_it, [&](const SyncseqCorr & l, const SyncseqCorr & r) -> bool
-                        {
-                            return l.period < r.period;
-                        });
-                    }
-
-                    first_it = next_it;
-                    step = 0;
-                }
+            for (const auto & key : key_arr) {
+                sorted_corr_autocorr_arr.push_back(corr_autocorr_arr[key.index]);
             }
 
-            // sort the last
-            if (step > 1) {
-                std::sort(first_it, end_it, [&](const SyncseqCorr & l, const SyncseqCorr & r) -> bool
-                {
-                    return l.period < r.period;
-                });
-            }
+            corr_autocorr_arr.swap(sorted_corr_autocorr_arr);
         }
         else {
             // just search and return a single value instead of sort
@@ -1716,12 +2323,114 @@ void calculate_syncseq_correlation(
     }
 }
 
+void calculate_syncseq_correlation(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrInOutParams &                       corr_io_params,
+    CorrOutParams &                         corr_out_params,
+    uint8_t *                               stream_buf,
+    CorrValues &                            corr_values,
+    std::vector<SyncseqCorr> &              corr_autocorr_arr,
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena,
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena)
+{
+    assert(stream_buf);
+
+    calculate_syncseq_correlation_impl(pool, corr_in_params, corr_io_params, corr_out_params, stream_buf, corr_values, corr_autocorr_arr,
+        corr_max_weighted_mean_sum_arena, corr_min_mean_deviat_sum_arena);
+}
+
+void calculate_syncseq_corr_values(
+    const std::vector<CorrInParams> &       corr_in_params_arr,
+    std::vector<CorrInOutParams> &          corr_io_params_arr,
+    std::vector<CorrOutParams> &            corr_out_params_arr,
+    const uint8_t *                         stream_buf,
+    std::vector<CorrValues> &               corr_values_arr)
+{
+    const size_t num_syncseqs = corr_in_params_arr.size();
+
+    assert(corr_io_params_arr.size() == num_syncseqs && corr_out_params_arr.size() == num_syncseqs);
+
+    corr_values_arr.resize(num_syncseqs);
+
+    if (!num_syncseqs) {
+        return;
+    }
+
+    const auto begin_calc_phase_time = std::chrono::high_resolution_clock::now();
+
+    const auto stream_bit_size = corr_in_params_arr.front().stream_bit_size;
+
+    const uint64_t num_corr_values = get_num_corr_values(stream_bit_size);
+
+    std::vector<CorrMultiplyTable> corr_multiply_table_arr(num_syncseqs);
+    std::vector<CorrValuesCalcState> corr_values_calc_state_arr(num_syncseqs);
+
+    for (size_t i = 0; i < num_syncseqs; i++) {
+        const CorrInParams & corr_in_params = corr_in_params_arr[i];
+
+        // the same stream and the same correlation values calculation method
+        assert(corr_in_params.stream_bit_size == stream_bit_size);
+        assert(corr_in_params.corr_mm == corr_in_params_arr.front().corr_mm);
+
+        const auto syncseq_bit_size = corr_in_params.syncseq_bit_size;
+
+        assert(syncseq_bit_size && syncseq_bit_size < stream_bit_size);
+
+        const uint32_t syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
+        const uint32_t syncseq_bytes = corr_io_params_arr[i].syncseq_int32 & syncseq_mask;
+
+        // write back
+        corr_io_params_arr[i].syncseq_int32 = syncseq_bytes;
+
+        make_corr_multiply_table(corr_in_params.corr_mm, syncseq_bytes, syncseq_bit_size, corr_multiply_table_arr[i]);
+
+        // the stream absolute maximums of the first synchro sequence of the same bit length
+        size_t stream_corr_absmax_index = 0;
+
+        while (corr_in_params_arr[stream_corr_absmax_index].syncseq_bit_size != syncseq_bit_size) {
+            stream_corr_absmax_index++;
+        }
+
+        init_corr_values_calc_state(corr_in_params, syncseq_bytes, corr_multiply_table_arr[i], stream_corr_absmax_index, num_corr_values,
+            corr_values_arr[i], corr_values_calc_state_arr[i]);
+    }
+
+    calculate_corr_values_blocks(get_corr_simd_kernels(corr_in_params_arr.front().simd_token), (const uint32_t *)stream_buf, num_corr_values,
+        corr_values_calc_state_arr.data(), num_syncseqs);
+
+    for (size_t i = 0; i < num_syncseqs; i++) {
+        CorrOutParams & corr_out_params = corr_out_params_arr[i];
+
+        // the time of the single pass for all the synchro sequences
+        end_calc_phase_time(_T("corr values"), begin_calc_phase_time, corr_out_params.calc_time_phases);
+
+        finish_corr_values_calc_state(corr_values_calc_state_arr[i], corr_out_params);
+    }
+}
+
+void calculate_syncseq_correlation_of_corr_values(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrInOutParams &                       corr_io_params,
+    CorrOutParams &                         corr_out_params,
+    CorrValues &                            corr_values,
+    std::vector<SyncseqCorr> &              corr_autocorr_arr,
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena,
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena)
+{
+    assert(corr_values.size() == get_num_corr_values(corr_in_params.stream_bit_size));
+
+    calculate_syncseq_correlation_impl(pool, corr_in_params, corr_io_params, corr_out_params, nullptr, corr_values, corr_autocorr_arr,
+        corr_max_weighted_mean_sum_arena, corr_min_mean_deviat_sum_arena);
+}
+
 // Search algorithm false positive statistic calculation code to test an algorithm phase for stability within input noise.
 //
 void calculate_syncseq_correlation_false_positive_stats(
-    const std::vector<float> &              corr_values_arr,
-    const std::deque<SyncseqCorrMean> *     corr_max_weighted_mean_sum_deq_ptr,
-    const std::deque<SyncseqCorrMeanDeviat> * corr_min_mean_deviat_sum_deq_ptr,
+    const CorrValues &                      corr_values,
+    const SyncseqCorrMeanSoA *              corr_max_weighted_mean_sum_arena_ptr,
+    const SyncseqCorrMeanDeviatSoA *        corr_min_mean_deviat_sum_arena_ptr,
     const std::vector<uint32_t> &           true_positions_index_arr,
     size_t &                                true_num,
     size_t                                  stat_arrs_size,
@@ -1750,7 +2459,7 @@ void calculate_syncseq_correlation_false_positive_stats(
 
     true_num = 0;
 
-    false_max_corr_arr[0] = true_max_corr_arr[0] = false_in_true_max_corr_arr[0] = corr_values_arr[0];
+    false_max_corr_arr[0] = true_max_corr_arr[0] = false_in_true_max_corr_arr[0] = corr_values.get(0);
     false_max_index_arr[0] = true_max_index_arr[0] = false_in_true_max_index_arr[0] = 0;
 
     bool is_true_position_index = false;
@@ -1769,8 +2478,8 @@ void calculate_syncseq_correlation_false_positive_stats(
         true_max_index_arr[0] = 0;
     }
 
-    for (size_t i = 1; i < corr_values_arr.size(); i++) {
-        const float v = corr_values_arr[i];
+    for (size_t i = 1; i < corr_values.size(); i++) {
+        const float v = corr_values.get(i);
 
         is_true_position_index = false;
 
@@ -1870,20 +2579,20 @@ void calculate_syncseq_correlation_false_positive_stats(
     }
 
     // the second and third phase algorithm output analysis
-    if (corr_max_weighted_mean_sum_deq_ptr && false_in_true_corr_max_weighted_mean_sum_arr_ptr) {
-        const auto & corr_max_weighted_mean_sum_deq = *corr_max_weighted_mean_sum_deq_ptr;
+    if (corr_max_weighted_mean_sum_arena_ptr && false_in_true_corr_max_weighted_mean_sum_arr_ptr) {
+        const auto & corr_max_weighted_mean_sum_arena = *corr_max_weighted_mean_sum_arena_ptr;
         auto & false_in_true_corr_max_weighted_mean_sum_arr = *false_in_true_corr_max_weighted_mean_sum_arr_ptr;
 
-        false_in_true_corr_max_weighted_mean_sum_arr.resize((std::min)(stat_arrs_size, corr_max_weighted_mean_sum_deq.size()));
+        false_in_true_corr_max_weighted_mean_sum_arr.resize((std::min)(stat_arrs_size, corr_max_weighted_mean_sum_arena.size()));
 
         for (size_t j = 0; j < false_in_true_corr_max_weighted_mean_sum_arr.size(); j++) {
-            auto & corr_mean_ref = corr_max_weighted_mean_sum_deq[j];
+            const SyncseqCorrMean corr_mean = corr_max_weighted_mean_sum_arena[j];
             auto & false_in_true_corr_max_weighted_mean_sum_ref = false_in_true_corr_max_weighted_mean_sum_arr[j];
 
-            false_in_true_corr_max_weighted_mean_sum_ref = SyncseqCorrMeanStats{ corr_mean_ref, false };
+            false_in_true_corr_max_weighted_mean_sum_ref = SyncseqCorrMeanStats{ corr_mean, false };
 
             for (auto true_position_index : true_positions_index_arr) {
-                if (true_position_index == corr_mean_ref.offset) {
+                if (true_position_index == corr_mean.offset) {
                     false_in_true_corr_max_weighted_mean_sum_ref.is_true = true;
                     break;
                 }
@@ -1891,20 +2600,20 @@ void calculate_syncseq_correlation_false_positive_stats(
         }
     }
 
-    if (corr_min_mean_deviat_sum_deq_ptr && false_in_true_corr_min_mean_deviat_sum_arr_ptr) {
-        const auto & corr_corr_min_mean_deviat_sum_deq = *corr_min_mean_deviat_sum_deq_ptr;
+    if (corr_min_mean_deviat_sum_arena_ptr && false_in_true_corr_min_mean_deviat_sum_arr_ptr) {
+        const auto & corr_min_mean_deviat_sum_arena = *corr_min_mean_deviat_sum_arena_ptr;
         auto & false_in_true_corr_min_mean_deviat_sum_arr = *false_in_true_corr_min_mean_deviat_sum_arr_ptr;
 
-        false_in_true_corr_min_mean_deviat_sum_arr.resize((std::min)(stat_arrs_size, corr_corr_min_mean_deviat_sum_deq.size()));
+        false_in_true_corr_min_mean_deviat_sum_arr.resize((std::min)(stat_arrs_size, corr_min_mean_deviat_sum_arena.size()));
 
         for (size_t j = 0; j < false_in_true_corr_min_mean_deviat_sum_arr.size(); j++) {
-            auto & corr_mean_deviat_ref = corr_corr_min_mean_deviat_sum_deq[j];
+            const SyncseqCorrMeanDeviat corr_mean_deviat = corr_min_mean_deviat_sum_arena[j];
             auto & false_in_true_corr_max_weighted_mean_sum_ref = false_in_true_corr_min_mean_deviat_sum_arr[j];
 
-            false_in_true_corr_max_weighted_mean_sum_ref = SyncseqCorrMeanDeviatStats{ corr_mean_deviat_ref, false };
+            false_in_true_corr_max_weighted_mean_sum_ref = SyncseqCorrMeanDeviatStats{ corr_mean_deviat, false };
 
             for (auto true_position_index : true_positions_index_arr) {
-                if (true_position_index == corr_mean_deviat_ref.offset) {
+                if (true_position_index == corr_mean_deviat.offset) {
                     false_in_true_corr_max_weighted_mean_sum_ref.is_true = true;
                     break;
                 }
@@ -1912,3 +2621,72 @@ void calculate_syncseq_correlation_false_positive_stats(
         }
     }
 }
+
+bool corr_autocorr_fft_self_test()
+{
+    // the FFT has less operations than the direct loop for these sizes
+    const uint64_t stream_min_period = 1024;
+    const uint64_t num_offset_shifts = 4096;
+    const uint64_t min_offset_shift = stream_min_period;
+    const uint64_t max_offset_shift = stream_min_period + num_offset_shifts - 1;
+    const size_t num_autocorr_values = size_t(min_offset_shift + num_offset_shifts);
+
+    std::vector<float> corr_values_arr(num_autocorr_values);
+
+    WorkStealingPool pool{ 1 };
+
+    const float corr_min_arr[] = { 0.9f, 0.99f };
+
+    for (const auto corr_min : corr_min_arr) {
+        // pseudo random correlation values in range [0; 1) filtered by the correlation minimum
+        uint32_t random_value = 0x1d0af;
+
+        for (auto & corr_value : corr_values_arr) {
+            random_value = random_value * 1664525 + 1013904223;
+
+            corr_value = float(random_value >> 8) / (1 << 24);
+
+            if (corr_value < corr_min) {
+                corr_value = 0;
+            }
+        }
+
+        std::vector<SyncseqCorr> corr_autocorr_arr[2];
+
+        for (size_t n = 0; n < 2; n++) {
+            CorrInParams corr_in_params{};
+            CorrOutParams corr_out_params{};
+
+            corr_in_params.simd_token = Impl::simd_unknown;
+            corr_in_params.autocorr_fft_min_size = n ? 0 : math::uint32_max;
+
+            corr_autocorr_arr[n].reserve(size_t(num_offset_shifts));
+
+            for (size_t i = 0; i < size_t(num_offset_shifts); i++) {
+                corr_autocorr_arr[n].push_back(SyncseqCorr{ 0, uint32_t(stream_min_period + i), 0, 0 });
+            }
+
+            calculate_corr_autocorr_values(pool, corr_in_params, corr_out_params, corr_values_arr.data(), 1.0f,
+                stream_min_period, min_offset_shift, max_offset_shift, num_offset_shifts, num_autocorr_values, corr_autocorr_arr[n]);
+        }
+
+        for (size_t i = 0; i < size_t(num_offset_shifts); i++) {
+            const SyncseqCorr & direct_autocorr = corr_autocorr_arr[0][i];
+            const SyncseqCorr & fft_autocorr = corr_autocorr_arr[1][i];
+
+            if (!std::isfinite(direct_autocorr.corr_value) || !std::isfinite(fft_autocorr.corr_value)) {
+                return false;
+            }
+
+            if (direct_autocorr.num_corr != fft_autocorr.num_corr) {
+                return false;
+            }
+
+            if (std::fabs(direct_autocorr.corr_value - fft_autocorr.corr_value) > direct_autocorr.corr_value * 1e-4f) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
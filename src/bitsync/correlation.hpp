@@ -3,13 +3,15 @@
 #include "common.hpp"
 
 #include <vector>
-#include <deque>
+#include <algorithm>
 #include <cstdlib>
+#include <cmath>
 
 
 #define DEFAULT_SYNCSEQ_MAXIMAL_REPEAT_PERIOD   16
 #define DEFAULT_MAX_PERIODS_IN_OFFSET           0
 #define DEFAULT_MAX_CORR_VALUES_PER_PERIOD      16
+#define DEFAULT_AUTOCORR_FFT_MIN_SIZE           65536
 
 #define DEFAULT_LINEAR_CORR_MIN                 0.71f
 #define DEFAULT_LINEAR_CORR_MEAN_MIN            0.81f
@@ -19,6 +21,10 @@
 
 #define DEFAULT_CORR_MEAN_BUF_MAX_SIZE_MB       400 // 400 Mb is default
 
+#define CORR_MEAN_ARENA_INIT_RECORDS            65536 // initial capacity of records of a correlation mean values arena
+
+
+class WorkStealingPool;
 
 struct Impl
 {
@@ -33,7 +39,11 @@ struct Impl
         impl_min_sum_of_corr_mean_deviat            = 2,
 
         // major time complexity: N * N
-        impl_max_weighted_autocorr_of_corr_values   = 3
+        impl_max_weighted_autocorr_of_corr_values   = 3,
+
+        // `impl_max_weighted_sum_of_corr_mean` and `impl_min_sum_of_corr_mean_deviat` together in a single pass
+        // major time complexity: N * N * ln(N)
+        impl_ensemble_of_corr_mean                  = 4
     };
 
     enum corr_multiply_method
@@ -44,12 +54,42 @@ struct Impl
 
         corr_muliply_dispersed_value_prime1033      = 2
     };
+
+    // instruction set of the correlation values calculation kernels
+    enum simd_token
+    {
+        simd_unknown                                = -1,   // select the best supported instruction set
+
+        simd_scalar                                 = 1,
+
+        simd_sse42                                  = 2,
+
+        simd_avx2                                   = 3,
+
+        simd_avx512                                 = 4
+    };
+
+    // storage type of the correlation values
+    enum corr_value_token
+    {
+        corr_value_unknown                          = -1,
+
+        corr_value_float32                          = 1,
+
+        // fixed point with the precision of 1/65535
+        corr_value_fixed16                          = 2,
+
+        // fixed point with the precision of 1/255
+        corr_value_fixed8                           = 3
+    };
 };
 
 struct CorrInParams
 {
     Impl::impl_token                impl_token;
     Impl::corr_multiply_method      corr_mm;
+    Impl::simd_token                simd_token;
+    Impl::corr_value_token          corr_value_token;
     uint64_t                        stream_bit_size;
     uint32_t                        syncseq_bit_size;
     float                           corr_min;
@@ -61,9 +101,12 @@ struct CorrInParams
     uint32_t                        max_periods_in_offset;          // -1 = no limit, 0 = 1 period excluding first bit of 2d period, 1 = 1 period including first bit of 2d period, >1 = N periods including first bit of N+1 period
     uint32_t                        max_corr_values_per_period;
     size_t                          max_corr_mean_bytes;
+    uint32_t                        num_threads;                    // 0 = number of the processor hardware threads
+    uint32_t                        autocorr_fft_min_size;          // minimal number of correlation values to calculate autocorrelation values through the FFT
     bool                            no_zero_corr;
     bool                            use_linear_corr;
     bool                            skip_calc_on_filtered_corr_value_use;
+    bool                            use_comb_corr_sum;
     bool                            skip_max_weighted_sum_of_corr_mean_calc;
     bool                            sort_at_first_by_max_corr_mean;
     bool                            return_sorted_result;
@@ -131,9 +174,48 @@ struct CorrOutParams // output only parameters
     bool                            accum_corr_mean_quit;           // Indicates correlation mean values calculation algorithm early quit.
 };
 
+// Correlation values per stream bit in one of storage types, where only the array of the storage type is used.
+// A fixed point value is a correlation value multiplied by the scale and rounded, the zero is a filtered value in all storage types.
+//
+struct CorrValues
+{
+    Impl::corr_value_token          corr_value_token;
+    float                           corr_value_scale;               // fixed point value of 1.0, 1 for the float values
+    std::vector<float>              float32_arr;
+    std::vector<uint16_t>           fixed16_arr;
+    std::vector<uint8_t>            fixed8_arr;
+
+    size_t size() const
+    {
+        switch (corr_value_token) {
+        case Impl::corr_value_fixed16:
+            return fixed16_arr.size();
+        case Impl::corr_value_fixed8:
+            return fixed8_arr.size();
+        default:;
+        }
+
+        return float32_arr.size();
+    }
+
+    // returns the value converted back to the float
+    float get(size_t index) const
+    {
+        switch (corr_value_token) {
+        case Impl::corr_value_fixed16:
+            return fixed16_arr[index] / corr_value_scale;
+        case Impl::corr_value_fixed8:
+            return fixed8_arr[index] / corr_value_scale;
+        default:;
+        }
+
+        return float32_arr[index];
+    }
+};
+
 struct SyncseqCorr
 {
-    uint32_t                        offset;                         // stream offset
+    uint64_t                        offset;                         // stream offset
     uint32_t                        period;                         // stream width/period
     uint32_t                        num_corr;                       // number of available correlations used to calculate correlation value
     float                           corr_value;                     // correlation value
@@ -141,7 +223,7 @@ struct SyncseqCorr
 
 struct SyncseqCorrMean
 {
-    uint32_t                        offset;                         // stream offset
+    uint64_t                        offset;                         // stream offset
     uint32_t                        period;                         // stream width/period
     uint32_t                        num_corr;                       // number of available correlations used to calculate mean value
     float                           corr_mean;                      // correlation mean (average) value
@@ -150,13 +232,209 @@ struct SyncseqCorrMean
 
 struct SyncseqCorrMeanDeviat
 {
-    uint32_t                        offset;                         // stream offset
+    uint64_t                        offset;                         // stream offset
     uint32_t                        period;                         // stream width/period
     uint32_t                        num_corr;                       // number of available correlations used to calculate mean value
     float                           corr_mean;                      // correlation mean (average) value
     float                           corr_mean_deviat_sum;           // correlation deviation from mean (average) values sum
 };
 
+inline float get_corr_sum(const SyncseqCorrMean & corr_mean)
+{
+    return corr_mean.corr_mean_sum;
+}
+
+inline float get_corr_sum(const SyncseqCorrMeanDeviat & corr_mean_deviat)
+{
+    return corr_mean_deviat.corr_mean_deviat_sum;
+}
+
+// Structure of arrays of `SyncseqCorrMean` or `SyncseqCorrMeanDeviat` records, where the bytes of records are accounted exactly and the capacity of
+// all arrays is grown twice at once when exceeded.
+//
+//  The high 32 bits of the stream offsets are stored only in the 64-bit layout, which is selected by the reserve if a stream offset can be
+//  greater than the 32-bit maximum, so a stream less than 2^32 bits has the same compact records as before.
+//
+template <typename T>
+class SyncseqCorrMeanArena
+{
+public:
+    static size_t get_record_bytes(bool is_offset64)
+    {
+        return sizeof(uint32_t) * (is_offset64 ? 4 : 3) + sizeof(float) * 2;
+    }
+
+    static bool is_offset64_stream(uint64_t stream_bit_size)
+    {
+        return stream_bit_size > uint64_t(math::uint32_max) + 1;
+    }
+
+    std::vector<uint32_t>           offset_arr;                     // stream offset, low 32 bits
+    std::vector<uint32_t>           offset_hi_arr;                  // stream offset, high 32 bits, empty in the 32-bit layout
+    std::vector<uint32_t>           period_arr;                     // stream width/period
+    std::vector<uint32_t>           num_corr_arr;                   // number of available correlations used to calculate mean value
+    std::vector<float>              corr_mean_arr;                  // correlation mean (average) value
+    std::vector<float>              corr_sum_arr;                   // correlation mean values sum or correlation deviation from mean values sum
+
+    SyncseqCorrMeanArena() :
+        m_is_offset64(false)
+    {
+    }
+
+    // must be called on empty arena
+    void reserve(size_t capacity, bool is_offset64)
+    {
+        assert(empty());
+
+        m_is_offset64 = is_offset64;
+
+        reserve(capacity);
+    }
+
+    void reserve(size_t capacity)
+    {
+        offset_arr.reserve(capacity);
+        offset_hi_arr.reserve(m_is_offset64 ? capacity : 0);
+        period_arr.reserve(capacity);
+        num_corr_arr.reserve(capacity);
+        corr_mean_arr.reserve(capacity);
+        corr_sum_arr.reserve(capacity);
+    }
+
+    size_t size() const
+    {
+        return offset_arr.size();
+    }
+
+    bool empty() const
+    {
+        return offset_arr.empty();
+    }
+
+    size_t capacity() const
+    {
+        return offset_arr.capacity();
+    }
+
+    bool is_offset64() const
+    {
+        return m_is_offset64;
+    }
+
+    size_t record_bytes() const
+    {
+        return get_record_bytes(m_is_offset64);
+    }
+
+    // bytes of records
+    size_t bytes() const
+    {
+        return size() * record_bytes();
+    }
+
+    uint64_t offset(size_t index) const
+    {
+        return m_is_offset64 ? offset_arr[index] | uint64_t(offset_hi_arr[index]) << 32 : offset_arr[index];
+    }
+
+    void clear()
+    {
+        resize(0);
+    }
+
+    void resize(size_t size)
+    {
+        offset_arr.resize(size);
+        offset_hi_arr.resize(m_is_offset64 ? size : 0);
+        period_arr.resize(size);
+        num_corr_arr.resize(size);
+        corr_mean_arr.resize(size);
+        corr_sum_arr.resize(size);
+    }
+
+    void push_back(const T & record)
+    {
+        assert(m_is_offset64 || record.offset <= math::uint32_max);
+
+        if (size() == capacity()) {
+            reserve((std::max)(capacity() * 2, size_t(CORR_MEAN_ARENA_INIT_RECORDS)));
+        }
+
+        offset_arr.push_back(uint32_t(record.offset));
+        if (m_is_offset64) {
+            offset_hi_arr.push_back(uint32_t(record.offset >> 32));
+        }
+        period_arr.push_back(record.period);
+        num_corr_arr.push_back(record.num_corr);
+        corr_mean_arr.push_back(record.corr_mean);
+        corr_sum_arr.push_back(get_corr_sum(record));
+    }
+
+    T operator[](size_t index) const
+    {
+        return T{ offset(index), period_arr[index], num_corr_arr[index], corr_mean_arr[index], corr_sum_arr[index] };
+    }
+
+    void set(size_t index, const T & record)
+    {
+        assert(m_is_offset64 || record.offset <= math::uint32_max);
+
+        offset_arr[index] = uint32_t(record.offset);
+        if (m_is_offset64) {
+            offset_hi_arr[index] = uint32_t(record.offset >> 32);
+        }
+        period_arr[index] = record.period;
+        num_corr_arr[index] = record.num_corr;
+        corr_mean_arr[index] = record.corr_mean;
+        corr_sum_arr[index] = get_corr_sum(record);
+    }
+
+    // Reorders the records range beginning from the first index, where the record of a range position is moved from the record of the absolute index
+    // of the same position in the index array.
+    //
+    void permute(size_t first, const std::vector<size_t> & index_arr)
+    {
+        permute_arr(offset_arr, first, index_arr, m_uint32_buf);
+        if (m_is_offset64) {
+            permute_arr(offset_hi_arr, first, index_arr, m_uint32_buf);
+        }
+        permute_arr(period_arr, first, index_arr, m_uint32_buf);
+        permute_arr(num_corr_arr, first, index_arr, m_uint32_buf);
+        permute_arr(corr_mean_arr, first, index_arr, m_float_buf);
+        permute_arr(corr_sum_arr, first, index_arr, m_float_buf);
+    }
+
+private:
+    template <typename U>
+    static void permute_arr(std::vector<U> & arr, size_t first, const std::vector<size_t> & index_arr, std::vector<U> & buf)
+    {
+        buf.resize(index_arr.size());
+
+        for (size_t i = 0; i < index_arr.size(); i++) {
+            buf[i] = arr[index_arr[i]];
+        }
+
+        std::copy(buf.begin(), buf.end(), arr.begin() + first);
+    }
+
+private:
+    bool                            m_is_offset64;
+    std::vector<uint32_t>           m_uint32_buf;
+    std::vector<float>              m_float_buf;
+};
+
+using SyncseqCorrMeanSoA = SyncseqCorrMeanArena<SyncseqCorrMean>;
+using SyncseqCorrMeanDeviatSoA = SyncseqCorrMeanArena<SyncseqCorrMeanDeviat>;
+
+// Multiplied bits lookup tables for a particular synchro sequence.
+// A multiplied bits value of a 32-bit block is a sum of 4 lookups by each block byte.
+//
+struct CorrMultiplyTable
+{
+    uint32_t                        syncseq_arr[4][256];            // partial multiplied values of a stream block byte and the synchro sequence byte of the same position
+    uint32_t                        stream_arr[4][256];             // partial multiplied values of a stream block byte and itself
+};
+
 struct SyncseqCorrMeanStats
 {
     SyncseqCorrMean                 corr;
@@ -173,20 +451,102 @@ float multiply_bits(Impl::corr_multiply_method mm, uint32_t in0_value, uint32_t
 
 float calculate_corr_value(Impl::corr_multiply_method mm, uint32_t in0_value, uint32_t in1_value, size_t size, float max_in0, float max_in1, bool make_linear_corr);
 
+void make_corr_multiply_table(Impl::corr_multiply_method mm, uint32_t syncseq_value, size_t size, CorrMultiplyTable & corr_multiply_table);
+
+// The synchro sequence bits out of the bit mask are not compared, for example, the bits of a partial baud.
+//
+void make_corr_multiply_table(Impl::corr_multiply_method mm, uint32_t syncseq_value, uint32_t syncseq_bit_mask, size_t size, CorrMultiplyTable & corr_multiply_table);
+
+// Returns the same value as `multiply_bits` for the table synchro sequence and the value.
+//
+inline float multiply_bits(const uint32_t (& table_arr)[4][256], uint32_t value)
+{
+    const uint32_t multiplied_value =
+        table_arr[0][value & 0xff] + table_arr[1][(value >> 8) & 0xff] + table_arr[2][(value >> 16) & 0xff] + table_arr[3][value >> 24];
+
+    return float(multiplied_value ? multiplied_value : 1); // return only minimal positive value
+}
+
+inline float calculate_corr_value(float multiplied_value, float max_in0, float max_in1, bool make_linear_corr)
+{
+    const float corr = multiplied_value / (std::max)(max_in0, max_in1);
+
+    // zero padded values from padded arrays must not be passed here
+    assert(0 < corr && 1.0f >= corr); // must be always in range (0; 1]
+
+    return make_linear_corr ? std::sqrt(corr) : corr;
+}
+
+// Converts a correlation value into a fixed point value, where the zero value is reserved for a filtered value.
+//
+inline uint32_t quantize_corr_value(float corr_value, float corr_value_scale)
+{
+    if (!corr_value) {
+        return 0;
+    }
+
+    const uint32_t fixed_corr_value = uint32_t(corr_value * corr_value_scale + 0.5f);
+
+    return fixed_corr_value ? fixed_corr_value : 1; // return only minimal positive value
+}
+
+// Converts and filters a block of not filtered correlation values, where the filter is applied to the fixed point values.
+//
+template <typename T>
+inline void quantize_corr_values_block(
+    const float * corr_values_arr, size_t block_size, float corr_value_scale, uint32_t fixed_corr_min, uint32_t fixed_filtered_corr_value,
+    T * fixed_corr_values_arr, size_t & num_corr_values_calc)
+{
+    for (size_t i = 0; i < block_size; i++) {
+        const uint32_t fixed_corr_value = quantize_corr_value(corr_values_arr[i], corr_value_scale);
+
+        const bool is_not_filtered = fixed_corr_value >= fixed_corr_min;
+
+        fixed_corr_values_arr[i] = T(is_not_filtered ? fixed_corr_value : fixed_filtered_corr_value);
+
+        num_corr_values_calc += is_not_filtered ? 1 : 0;
+    }
+}
+
 void calculate_syncseq_correlation(
+    WorkStealingPool &                      pool,                               // pool of workers to calculate the periods or the lags
     const CorrInParams &                    corr_in_params,
     CorrInOutParams &                       corr_io_params,
     CorrOutParams &                         corr_out_params,
     uint8_t *                               stream_buf,                         // buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block
-    std::vector<float> &                    corr_values_arr,                    // correlation values per stream bit
+    CorrValues &                            corr_values,                        // correlation values per stream bit in the `corr_in_params.corr_value_token` storage type
     std::vector<SyncseqCorr> &              corr_autocorr_arr,                  // resulted synchro sequence offset and period variants sorted at first for correlation max values (for min offset/period at second/third if enabled)
-    std::deque<SyncseqCorrMean> &           corr_max_weighted_mean_sum_deq,     // resulted synchro sequence offset and period variants sorted at first for correlation max weighted mean sum (for min offset/period at second/third if enabled)
-    std::deque<SyncseqCorrMeanDeviat> &     corr_min_mean_deviat_sum_deq);      // resulted synchro sequence offset and period variants sorted at first for correlation min mean deviation sum (for min offset/period at second/third if enabled)
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena,   // resulted synchro sequence offset and period variants sorted at first for correlation max weighted mean sum (for min offset/period at second/third if enabled)
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena);    // resulted synchro sequence offset and period variants sorted at first for correlation min mean deviation sum (for min offset/period at second/third if enabled)
+
+// Calculates correlation values of multiple synchro sequences by a single pass over the stream (phase 1 of `calculate_syncseq_correlation`).
+//
+//  A stream block is loaded once for all the synchro sequences and the stream absolute maximums are calculated once for all the synchro sequences of
+//  the same bit length. All the synchro sequences must have the same stream bit length and the same correlation multiply method.
+//
+void calculate_syncseq_corr_values(
+    const std::vector<CorrInParams> &       corr_in_params_arr,
+    std::vector<CorrInOutParams> &          corr_io_params_arr,                 // writes back the masked synchro sequences
+    std::vector<CorrOutParams> &            corr_out_params_arr,
+    const uint8_t *                         stream_buf,                         // buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block
+    std::vector<CorrValues> &               corr_values_arr);                   // correlation values per stream bit of each synchro sequence
+
+// The same as `calculate_syncseq_correlation`, but continues from the correlation values calculated by `calculate_syncseq_corr_values`.
+//
+void calculate_syncseq_correlation_of_corr_values(
+    WorkStealingPool &                      pool,
+    const CorrInParams &                    corr_in_params,
+    CorrInOutParams &                       corr_io_params,
+    CorrOutParams &                         corr_out_params,
+    CorrValues &                            corr_values,                        // calculated correlation values per stream bit
+    std::vector<SyncseqCorr> &              corr_autocorr_arr,
+    SyncseqCorrMeanSoA &                    corr_max_weighted_mean_sum_arena,
+    SyncseqCorrMeanDeviatSoA &              corr_min_mean_deviat_sum_arena);
 
 void calculate_syncseq_correlation_false_positive_stats(
-    const std::vector<float> &              corr_values_arr,                    // calculated correlation values in range (0; 1]
-    const std::deque<SyncseqCorrMean> *     corr_max_weighted_mean_sum_deq_ptr, // calculated correlation max weighted mean sum
-    const std::deque<SyncseqCorrMeanDeviat> * corr_min_mean_deviat_sum_deq_ptr, // calculated correlation min mean deviation sum
+    const CorrValues &                      corr_values,                        // calculated correlation values in range (0; 1]
+    const SyncseqCorrMeanSoA *              corr_max_weighted_mean_sum_arena_ptr, // calculated correlation max weighted mean sum
+    const SyncseqCorrMeanDeviatSoA *        corr_min_mean_deviat_sum_arena_ptr, // calculated correlation min mean deviation sum
     const std::vector<uint32_t> &           true_positions_index_arr,           // true positions (indexes) in the stream
     size_t &                                true_num,                           // number of true positions
     size_t                                  stat_arrs_size,                     // sizes of all output statistic arrays
@@ -200,3 +560,8 @@ void calculate_syncseq_correlation_false_positive_stats(
     std::vector<size_t> &                   saved_true_in_false_max_index_arr,
     std::vector<SyncseqCorrMeanStats> *     false_in_true_corr_max_weighted_mean_sum_arr_ptr,   // false positive correlation values within true positions, true positions is zeroed for convenience, sorted from correlation mean weighted sum maximum value to minimum
     std::vector<SyncseqCorrMeanDeviatStats> * false_in_true_corr_min_mean_deviat_sum_arr_ptr);  // false positive correlation values within true positions, true positions is zeroed for convenience, sorted from correlation mean deviation sum minimum value to maximum
+
+// Checks the autocorrelation values calculated through the FFT against the direct loop on the correlation values filtered by a high correlation
+// minimum, where many lags have no not zero products.
+//
+bool corr_autocorr_fft_self_test();
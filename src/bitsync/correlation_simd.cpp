@@ -0,0 +1,954 @@
+// Author: Andrey Dibrov (andry at inbox dot ru)
+//
+
+#include "correlation_simd.hpp"
+
+#include <tacklelib/utility/math.hpp>
+
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#   define CORR_SIMD_X86 1
+#else
+#   define CORR_SIMD_X86 0
+#endif
+
+#if CORR_SIMD_X86
+#   include <immintrin.h>
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+// NOTE:
+//  The MSVC does compile any instruction set intrinsics without additional options, when the GCC and the Clang does need the target attribute per function.
+//
+#if CORR_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#   define CORR_SIMD_TARGET(target_str) __attribute__((target(target_str)))
+#else
+#   define CORR_SIMD_TARGET(target_str)
+#endif
+
+
+namespace {
+
+    inline uint32_t count_bits16(uint32_t value)
+    {
+        value = value - ((value >> 1) & 0x5555);
+        value = (value & 0x3333) + ((value >> 2) & 0x3333);
+        value = (value + (value >> 4)) & 0x0f0f;
+        return (value + (value >> 8)) & 0x1f;
+    }
+
+    // scalar kernels as a reference for all others
+
+    void multiply_bits_block_scalar(
+        const uint32_t (& table_arr)[4][256], const uint32_t * stream_buf32, uint32_t syncseq_mask, size_t block_size,
+        float * multiplied_values_arr)
+    {
+        assert(block_size && CORR_BLOCK_BIT_SIZE >= block_size);
+
+        for (size_t from = 0; from * 32 < block_size; from++) {
+            const uint64_t from64 = *(uint64_t *)(stream_buf32 + from);
+
+            float * multiplied_values_arr32 = multiplied_values_arr + from * 32;
+
+            for (uint32_t i = 0; i < 32; i++) {
+                const uint32_t from_shifted = uint32_t(from64 >> i) & syncseq_mask;
+
+                multiplied_values_arr32[i] = multiply_bits(table_arr, from_shifted);
+            }
+        }
+    }
+
+    inline void calculate_corr_value_scalar(
+        const CorrValuesBlockParams & params, float multiplied_value, float stream_corr_absmax,
+        float & corr_value_out, CorrValuesBlockStats & stats)
+    {
+        const auto corr_value = calculate_corr_value(multiplied_value, params.syncseq_corr_absmax, stream_corr_absmax, params.use_linear_corr);
+
+        stats.min_corr_value = (std::min)(stats.min_corr_value, corr_value);
+        stats.max_corr_value = (std::max)(stats.max_corr_value, corr_value);
+
+        const bool is_not_filtered = corr_value >= params.corr_min;
+
+        corr_value_out = is_not_filtered ? corr_value : params.filtered_corr_value;
+
+        stats.num_corr_values_calc += is_not_filtered ? 1 : 0;
+    }
+
+    void calculate_corr_values_block_scalar(
+        const CorrValuesBlockParams & params, const float * multiplied_values_arr, const float * stream_corr_absmax_arr, size_t block_size,
+        float * corr_values_arr, CorrValuesBlockStats & stats)
+    {
+        for (size_t i = 0; i < block_size; i++) {
+            calculate_corr_value_scalar(params, multiplied_values_arr[i], stream_corr_absmax_arr[i], corr_values_arr[i], stats);
+        }
+    }
+
+    void calculate_autocorr_tile_scalar(
+        const float * corr_values_arr, size_t lag, size_t first, size_t last,
+        float * numerator_arr, uint32_t * num_corr_arr)
+    {
+        for (size_t t = 0; t < CORR_AUTOCORR_TILE_SIZE; t++) {
+            const float * shifted_corr_values_arr = corr_values_arr + lag + t;
+
+            float numerator = numerator_arr[t];
+            uint32_t num_corr = num_corr_arr[t];
+
+            for (size_t j = first; j < last; j++) {
+                const float corr_value = corr_values_arr[j] * shifted_corr_values_arr[j];
+
+                // count not zero
+                if (corr_value) {
+                    numerator += corr_value * corr_value;
+                    num_corr++;
+                }
+            }
+
+            numerator_arr[t] = numerator;
+            num_corr_arr[t] = num_corr;
+        }
+    }
+
+    // the byte of the bit stream beginning from the bit offset in range [0; 7]
+    inline uint32_t get_shifted_byte(const uint8_t * buf, size_t byte_offset, uint32_t shifted_bit_offset)
+    {
+        return uint8_t((buf[byte_offset] | (uint32_t(buf[byte_offset + 1]) << 8)) >> shifted_bit_offset);
+    }
+
+    // Translates the bytes beginning from the byte, where the translated bits of the previous bytes are already stored in the output buffer.
+    //
+    inline void translate_bytes_from_scalar(
+        const BaudTranslateTable & table, const uint8_t * buf, size_t from, size_t size, uint32_t shifted_bit_offset,
+        uint8_t * buf_out)
+    {
+        if (!shifted_bit_offset) {
+            for (size_t k = from; k < size; k++) {
+                buf_out[k] = table.byte_arr[buf[k]];
+            }
+            return;
+        }
+
+        // the bits of an output byte before the translated bits of the input byte
+        const uint32_t low_mask = 0xff >> (8 - shifted_bit_offset);
+
+        uint32_t low_bits = from ?
+            uint32_t(table.byte_arr[get_shifted_byte(buf, from - 1, shifted_bit_offset)]) >> (8 - shifted_bit_offset) :
+            buf_out[0] & low_mask;
+
+        for (size_t k = from; k < size; k++) {
+            const uint32_t translated_byte = table.byte_arr[get_shifted_byte(buf, k, shifted_bit_offset)];
+
+            buf_out[k] = uint8_t(low_bits | (translated_byte << shifted_bit_offset));
+
+            low_bits = translated_byte >> (8 - shifted_bit_offset);
+        }
+
+        if (size) {
+            buf_out[size] = uint8_t((buf_out[size] & ~low_mask) | low_bits);
+        }
+    }
+
+    void translate_bytes_scalar(
+        const BaudTranslateTable & table, const uint8_t * buf, size_t size, uint32_t shifted_bit_offset,
+        uint8_t * buf_out)
+    {
+        assert(8 > shifted_bit_offset);
+
+        translate_bytes_from_scalar(table, buf, 0, size, shifted_bit_offset, buf_out);
+    }
+
+#if CORR_SIMD_X86
+    // NOTE:
+    //  All the vector operations here are exactly rounded as the scalar ones (conversion, division and square root), the minimum and the maximum
+    //  are independent to the order, so all the kernels must return bit exact values.
+    //
+
+    CORR_SIMD_TARGET("sse4.2")
+    void calculate_corr_values_block_sse42(
+        const CorrValuesBlockParams & params, const float * multiplied_values_arr, const float * stream_corr_absmax_arr, size_t block_size,
+        float * corr_values_arr, CorrValuesBlockStats & stats)
+    {
+        const __m128 syncseq_corr_absmax = _mm_set1_ps(params.syncseq_corr_absmax);
+        const __m128 corr_min = _mm_set1_ps(params.corr_min);
+        const __m128 filtered_corr_value = _mm_set1_ps(params.filtered_corr_value);
+
+        __m128 min_corr_value = _mm_set1_ps(stats.min_corr_value);
+        __m128 max_corr_value = _mm_set1_ps(stats.max_corr_value);
+
+        size_t i = 0;
+
+        for (; i + 4 <= block_size; i += 4) {
+            __m128 corr_value = _mm_div_ps(_mm_loadu_ps(multiplied_values_arr + i), _mm_max_ps(syncseq_corr_absmax, _mm_loadu_ps(stream_corr_absmax_arr + i)));
+
+            if (params.use_linear_corr) {
+                corr_value = _mm_sqrt_ps(corr_value);
+            }
+
+            min_corr_value = _mm_min_ps(min_corr_value, corr_value);
+            max_corr_value = _mm_max_ps(max_corr_value, corr_value);
+
+            const __m128 is_not_filtered = _mm_cmpge_ps(corr_value, corr_min);
+
+            _mm_storeu_ps(corr_values_arr + i, _mm_blendv_ps(filtered_corr_value, corr_value, is_not_filtered));
+
+            stats.num_corr_values_calc += count_bits16(uint32_t(_mm_movemask_ps(is_not_filtered)));
+        }
+
+        float min_corr_value_arr[4];
+        float max_corr_value_arr[4];
+
+        _mm_storeu_ps(min_corr_value_arr, min_corr_value);
+        _mm_storeu_ps(max_corr_value_arr, max_corr_value);
+
+        for (size_t j = 0; j < 4; j++) {
+            stats.min_corr_value = (std::min)(stats.min_corr_value, min_corr_value_arr[j]);
+            stats.max_corr_value = (std::max)(stats.max_corr_value, max_corr_value_arr[j]);
+        }
+
+        for (; i < block_size; i++) {
+            calculate_corr_value_scalar(params, multiplied_values_arr[i], stream_corr_absmax_arr[i], corr_values_arr[i], stats);
+        }
+    }
+
+    // NOTE:
+    //  The autocorrelation kernels calculate the lags of a tile in the vector lanes, so each lag is accumulated in the same order as by the scalar
+    //  kernel. The mask between the multiplication and the addition does prevent the contraction into the fused multiply-add, which is not
+    //  exactly rounded as the scalar code. The addition of the masked zero does not change a sum.
+    //
+
+    CORR_SIMD_TARGET("sse4.2")
+    void calculate_autocorr_tile_sse42(
+        const float * corr_values_arr, size_t lag, size_t first, size_t last,
+        float * numerator_arr, uint32_t * num_corr_arr)
+    {
+        const size_t num_vectors = CORR_AUTOCORR_TILE_SIZE / 4;
+
+        const __m128 zero = _mm_setzero_ps();
+
+        __m128 numerator[num_vectors];
+        __m128i num_corr[num_vectors];
+
+        for (size_t k = 0; k < num_vectors; k++) {
+            numerator[k] = _mm_loadu_ps(numerator_arr + k * 4);
+            num_corr[k] = _mm_loadu_si128((const __m128i *)(num_corr_arr + k * 4));
+        }
+
+        const float * shifted_corr_values_arr = corr_values_arr + lag;
+
+        for (size_t j = first; j < last; j++) {
+            const __m128 corr_value0 = _mm_set1_ps(corr_values_arr[j]);
+
+            for (size_t k = 0; k < num_vectors; k++) {
+                const __m128 corr_value = _mm_mul_ps(corr_value0, _mm_loadu_ps(shifted_corr_values_arr + j + k * 4));
+
+                // all bits set or -1 as an integer
+                const __m128 is_not_zero = _mm_cmpneq_ps(corr_value, zero);
+
+                numerator[k] = _mm_add_ps(numerator[k], _mm_and_ps(_mm_mul_ps(corr_value, corr_value), is_not_zero));
+                num_corr[k] = _mm_sub_epi32(num_corr[k], _mm_castps_si128(is_not_zero));
+            }
+        }
+
+        for (size_t k = 0; k < num_vectors; k++) {
+            _mm_storeu_ps(numerator_arr + k * 4, numerator[k]);
+            _mm_storeu_si128((__m128i *)(num_corr_arr + k * 4), num_corr[k]);
+        }
+    }
+
+    // NOTE:
+    //  The bytes translation kernels translate each nibble by a byte shuffle, where the table of 16 bytes is the same in each 128-bit lane.
+    //  The bytes of a bit stream shifted by a bit offset are shifted as 16-bit values and masked, so the bits of a neighbour byte are not mixed.
+    //
+
+    CORR_SIMD_TARGET("sse4.2")
+    inline __m128i translate_bytes16_sse42(__m128i value, __m128i low_nibble_table, __m128i high_nibble_table, __m128i nibble_mask)
+    {
+        return _mm_or_si128(
+            _mm_shuffle_epi8(low_nibble_table, _mm_and_si128(value, nibble_mask)),
+            _mm_shuffle_epi8(high_nibble_table, _mm_and_si128(_mm_srli_epi16(value, 4), nibble_mask)));
+    }
+
+    CORR_SIMD_TARGET("sse4.2")
+    inline __m128i load_shifted_bytes16_sse42(const uint8_t * buf, __m128i shift, __m128i inv_shift, __m128i low_mask, __m128i high_mask)
+    {
+        const __m128i value = _mm_loadu_si128((const __m128i *)buf);
+        const __m128i next_value = _mm_loadu_si128((const __m128i *)(buf + 1));
+
+        return _mm_or_si128(_mm_and_si128(_mm_srl_epi16(value, shift), low_mask), _mm_and_si128(_mm_sll_epi16(next_value, inv_shift), high_mask));
+    }
+
+    CORR_SIMD_TARGET("sse4.2")
+    void translate_bytes_sse42(
+        const BaudTranslateTable & table, const uint8_t * buf, size_t size, uint32_t shifted_bit_offset,
+        uint8_t * buf_out)
+    {
+        assert(8 > shifted_bit_offset);
+
+        const __m128i low_nibble_table = _mm_loadu_si128((const __m128i *)table.low_nibble_arr);
+        const __m128i high_nibble_table = _mm_loadu_si128((const __m128i *)table.high_nibble_arr);
+        const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+
+        size_t k = 0;
+
+        if (!shifted_bit_offset) {
+            for (; k + 16 <= size; k += 16) {
+                _mm_storeu_si128((__m128i *)(buf_out + k),
+                    translate_bytes16_sse42(_mm_loadu_si128((const __m128i *)(buf + k)), low_nibble_table, high_nibble_table, nibble_mask));
+            }
+        }
+        else if (size > 16) {
+            const __m128i shift = _mm_cvtsi32_si128(int(shifted_bit_offset));
+            const __m128i inv_shift = _mm_cvtsi32_si128(int(8 - shifted_bit_offset));
+            const __m128i low_mask = _mm_set1_epi8(char(0xff >> shifted_bit_offset));
+            const __m128i high_mask = _mm_set1_epi8(char(0xff << (8 - shifted_bit_offset)));
+            const __m128i out_low_mask = _mm_set1_epi8(char(0xff >> (8 - shifted_bit_offset)));
+            const __m128i out_high_mask = _mm_set1_epi8(char(0xff << shifted_bit_offset));
+
+            // the first byte keeps the bits before the translated bits
+            translate_bytes_from_scalar(table, buf, 0, 1, shifted_bit_offset, buf_out);
+
+            // each output byte is of the translated bytes of the same and the previous input bytes
+            for (k = 1; k + 16 <= size; k += 16) {
+                const __m128i translated_value = translate_bytes16_sse42(
+                    load_shifted_bytes16_sse42(buf + k, shift, inv_shift, low_mask, high_mask), low_nibble_table, high_nibble_table, nibble_mask);
+                const __m128i prev_translated_value = translate_bytes16_sse42(
+                    load_shifted_bytes16_sse42(buf + k - 1, shift, inv_shift, low_mask, high_mask), low_nibble_table, high_nibble_table, nibble_mask);
+
+                _mm_storeu_si128((__m128i *)(buf_out + k), _mm_or_si128(
+                    _mm_and_si128(_mm_sll_epi16(translated_value, shift), out_high_mask),
+                    _mm_and_si128(_mm_srl_epi16(prev_translated_value, inv_shift), out_low_mask)));
+            }
+        }
+
+        translate_bytes_from_scalar(table, buf, k, size, shifted_bit_offset, buf_out);
+    }
+
+    CORR_SIMD_TARGET("avx2")
+    void multiply_bits_block_avx2(
+        const uint32_t (& table_arr)[4][256], const uint32_t * stream_buf32, uint32_t syncseq_mask, size_t block_size,
+        float * multiplied_values_arr)
+    {
+        assert(block_size && CORR_BLOCK_BIT_SIZE >= block_size);
+
+        const __m256i lane_shift = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i value_mask = _mm256_set1_epi32(int(syncseq_mask));
+        const __m256i byte_mask = _mm256_set1_epi32(0xff);
+        const __m256i bit_size32 = _mm256_set1_epi32(32);
+        const __m256i one = _mm256_set1_epi32(1);
+
+        for (size_t from = 0; from * 32 < block_size; from++) {
+            // 64-bit block as 2 broadcasted 32-bit halves
+            const __m256i from_low = _mm256_set1_epi32(int(stream_buf32[from]));
+            const __m256i from_high = _mm256_set1_epi32(int(stream_buf32[from + 1]));
+
+            float * multiplied_values_arr32 = multiplied_values_arr + from * 32;
+
+            for (uint32_t i = 0; i < 32; i += 8) {
+                const __m256i shift = _mm256_add_epi32(lane_shift, _mm256_set1_epi32(int(i)));
+
+                // the variable shift by 32 bits gains zero
+                const __m256i from_shifted = _mm256_and_si256(
+                    _mm256_or_si256(_mm256_srlv_epi32(from_low, shift), _mm256_sllv_epi32(from_high, _mm256_sub_epi32(bit_size32, shift))),
+                    value_mask);
+
+                __m256i multiplied_value = _mm256_i32gather_epi32((const int *)table_arr[0], _mm256_and_si256(from_shifted, byte_mask), 4);
+
+                multiplied_value = _mm256_add_epi32(multiplied_value,
+                    _mm256_i32gather_epi32((const int *)table_arr[1], _mm256_and_si256(_mm256_srli_epi32(from_shifted, 8), byte_mask), 4));
+                multiplied_value = _mm256_add_epi32(multiplied_value,
+                    _mm256_i32gather_epi32((const int *)table_arr[2], _mm256_and_si256(_mm256_srli_epi32(from_shifted, 16), byte_mask), 4));
+                multiplied_value = _mm256_add_epi32(multiplied_value,
+                    _mm256_i32gather_epi32((const int *)table_arr[3], _mm256_srli_epi32(from_shifted, 24), 4));
+
+                // return only minimal positive value
+                multiplied_value = _mm256_max_epu32(multiplied_value, one);
+
+                _mm256_storeu_ps(multiplied_values_arr32 + i, _mm256_cvtepi32_ps(multiplied_value));
+            }
+        }
+    }
+
+    CORR_SIMD_TARGET("avx2")
+    void calculate_corr_values_block_avx2(
+        const CorrValuesBlockParams & params, const float * multiplied_values_arr, const float * stream_corr_absmax_arr, size_t block_size,
+        float * corr_values_arr, CorrValuesBlockStats & stats)
+    {
+        const __m256 syncseq_corr_absmax = _mm256_set1_ps(params.syncseq_corr_absmax);
+        const __m256 corr_min = _mm256_set1_ps(params.corr_min);
+        const __m256 filtered_corr_value = _mm256_set1_ps(params.filtered_corr_value);
+
+        __m256 min_corr_value = _mm256_set1_ps(stats.min_corr_value);
+        __m256 max_corr_value = _mm256_set1_ps(stats.max_corr_value);
+
+        size_t i = 0;
+
+        for (; i + 8 <= block_size; i += 8) {
+            __m256 corr_value = _mm256_div_ps(_mm256_loadu_ps(multiplied_values_arr + i), _mm256_max_ps(syncseq_corr_absmax, _mm256_loadu_ps(stream_corr_absmax_arr + i)));
+
+            if (params.use_linear_corr) {
+                corr_value = _mm256_sqrt_ps(corr_value);
+            }
+
+            min_corr_value = _mm256_min_ps(min_corr_value, corr_value);
+            max_corr_value = _mm256_max_ps(max_corr_value, corr_value);
+
+            const __m256 is_not_filtered = _mm256_cmp_ps(corr_value, corr_min, _CMP_GE_OQ);
+
+            _mm256_storeu_ps(corr_values_arr + i, _mm256_blendv_ps(filtered_corr_value, corr_value, is_not_filtered));
+
+            stats.num_corr_values_calc += count_bits16(uint32_t(_mm256_movemask_ps(is_not_filtered)));
+        }
+
+        float min_corr_value_arr[8];
+        float max_corr_value_arr[8];
+
+        _mm256_storeu_ps(min_corr_value_arr, min_corr_value);
+        _mm256_storeu_ps(max_corr_value_arr, max_corr_value);
+
+        for (size_t j = 0; j < 8; j++) {
+            stats.min_corr_value = (std::min)(stats.min_corr_value, min_corr_value_arr[j]);
+            stats.max_corr_value = (std::max)(stats.max_corr_value, max_corr_value_arr[j]);
+        }
+
+        for (; i < block_size; i++) {
+            calculate_corr_value_scalar(params, multiplied_values_arr[i], stream_corr_absmax_arr[i], corr_values_arr[i], stats);
+        }
+    }
+
+    CORR_SIMD_TARGET("avx2")
+    void calculate_autocorr_tile_avx2(
+        const float * corr_values_arr, size_t lag, size_t first, size_t last,
+        float * numerator_arr, uint32_t * num_corr_arr)
+    {
+        const size_t num_vectors = CORR_AUTOCORR_TILE_SIZE / 8;
+
+        const __m256 zero = _mm256_setzero_ps();
+
+        __m256 numerator[num_vectors];
+        __m256i num_corr[num_vectors];
+
+        for (size_t k = 0; k < num_vectors; k++) {
+            numerator[k] = _mm256_loadu_ps(numerator_arr + k * 8);
+            num_corr[k] = _mm256_loadu_si256((const __m256i *)(num_corr_arr + k * 8));
+        }
+
+        const float * shifted_corr_values_arr = corr_values_arr + lag;
+
+        for (size_t j = first; j < last; j++) {
+            const __m256 corr_value0 = _mm256_set1_ps(corr_values_arr[j]);
+
+            for (size_t k = 0; k < num_vectors; k++) {
+                const __m256 corr_value = _mm256_mul_ps(corr_value0, _mm256_loadu_ps(shifted_corr_values_arr + j + k * 8));
+
+                // all bits set or -1 as an integer
+                const __m256 is_not_zero = _mm256_cmp_ps(corr_value, zero, _CMP_NEQ_UQ);
+
+                numerator[k] = _mm256_add_ps(numerator[k], _mm256_and_ps(_mm256_mul_ps(corr_value, corr_value), is_not_zero));
+                num_corr[k] = _mm256_sub_epi32(num_corr[k], _mm256_castps_si256(is_not_zero));
+            }
+        }
+
+        for (size_t k = 0; k < num_vectors; k++) {
+            _mm256_storeu_ps(numerator_arr + k * 8, numerator[k]);
+            _mm256_storeu_si256((__m256i *)(num_corr_arr + k * 8), num_corr[k]);
+        }
+    }
+
+    CORR_SIMD_TARGET("avx2")
+    inline __m256i translate_bytes32_avx2(__m256i value, __m256i low_nibble_table, __m256i high_nibble_table, __m256i nibble_mask)
+    {
+        return _mm256_or_si256(
+            _mm256_shuffle_epi8(low_nibble_table, _mm256_and_si256(value, nibble_mask)),
+            _mm256_shuffle_epi8(high_nibble_table, _mm256_and_si256(_mm256_srli_epi16(value, 4), nibble_mask)));
+    }
+
+    CORR_SIMD_TARGET("avx2")
+    inline __m256i load_shifted_bytes32_avx2(const uint8_t * buf, __m128i shift, __m128i inv_shift, __m256i low_mask, __m256i high_mask)
+    {
+        const __m256i value = _mm256_loadu_si256((const __m256i *)buf);
+        const __m256i next_value = _mm256_loadu_si256((const __m256i *)(buf + 1));
+
+        return _mm256_or_si256(
+            _mm256_and_si256(_mm256_srl_epi16(value, shift), low_mask), _mm256_and_si256(_mm256_sll_epi16(next_value, inv_shift), high_mask));
+    }
+
+    CORR_SIMD_TARGET("avx2")
+    void translate_bytes_avx2(
+        const BaudTranslateTable & table, const uint8_t * buf, size_t size, uint32_t shifted_bit_offset,
+        uint8_t * buf_out)
+    {
+        assert(8 > shifted_bit_offset);
+
+        const __m256i low_nibble_table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)table.low_nibble_arr));
+        const __m256i high_nibble_table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)table.high_nibble_arr));
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+
+        size_t k = 0;
+
+        if (!shifted_bit_offset) {
+            for (; k + 32 <= size; k += 32) {
+                _mm256_storeu_si256((__m256i *)(buf_out + k),
+                    translate_bytes32_avx2(_mm256_loadu_si256((const __m256i *)(buf + k)), low_nibble_table, high_nibble_table, nibble_mask));
+            }
+        }
+        else if (size > 32) {
+            const __m128i shift = _mm_cvtsi32_si128(int(shifted_bit_offset));
+            const __m128i inv_shift = _mm_cvtsi32_si128(int(8 - shifted_bit_offset));
+            const __m256i low_mask = _mm256_set1_epi8(char(0xff >> shifted_bit_offset));
+            const __m256i high_mask = _mm256_set1_epi8(char(0xff << (8 - shifted_bit_offset)));
+            const __m256i out_low_mask = _mm256_set1_epi8(char(0xff >> (8 - shifted_bit_offset)));
+            const __m256i out_high_mask = _mm256_set1_epi8(char(0xff << shifted_bit_offset));
+
+            // the first byte keeps the bits before the translated bits
+            translate_bytes_from_scalar(table, buf, 0, 1, shifted_bit_offset, buf_out);
+
+            // each output byte is of the translated bytes of the same and the previous input bytes
+            for (k = 1; k + 32 <= size; k += 32) {
+                const __m256i translated_value = translate_bytes32_avx2(
+                    load_shifted_bytes32_avx2(buf + k, shift, inv_shift, low_mask, high_mask), low_nibble_table, high_nibble_table, nibble_mask);
+                const __m256i prev_translated_value = translate_bytes32_avx2(
+                    load_shifted_bytes32_avx2(buf + k - 1, shift, inv_shift, low_mask, high_mask), low_nibble_table, high_nibble_table, nibble_mask);
+
+                _mm256_storeu_si256((__m256i *)(buf_out + k), _mm256_or_si256(
+                    _mm256_and_si256(_mm256_sll_epi16(translated_value, shift), out_high_mask),
+                    _mm256_and_si256(_mm256_srl_epi16(prev_translated_value, inv_shift), out_low_mask)));
+            }
+        }
+
+        translate_bytes_from_scalar(table, buf, k, size, shifted_bit_offset, buf_out);
+    }
+
+    CORR_SIMD_TARGET("avx512f")
+    void multiply_bits_block_avx512(
+        const uint32_t (& table_arr)[4][256], const uint32_t * stream_buf32, uint32_t syncseq_mask, size_t block_size,
+        float * multiplied_values_arr)
+    {
+        assert(block_size && CORR_BLOCK_BIT_SIZE >= block_size);
+
+        const __m512i lane_shift = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const __m512i value_mask = _mm512_set1_epi32(int(syncseq_mask));
+        const __m512i byte_mask = _mm512_set1_epi32(0xff);
+        const __m512i bit_size32 = _mm512_set1_epi32(32);
+        const __m512i one = _mm512_set1_epi32(1);
+
+        for (size_t from = 0; from * 32 < block_size; from++) {
+            // 64-bit block as 2 broadcasted 32-bit halves
+            const __m512i from_low = _mm512_set1_epi32(int(stream_buf32[from]));
+            const __m512i from_high = _mm512_set1_epi32(int(stream_buf32[from + 1]));
+
+            float * multiplied_values_arr32 = multiplied_values_arr + from * 32;
+
+            for (uint32_t i = 0; i < 32; i += 16) {
+                const __m512i shift = _mm512_add_epi32(lane_shift, _mm512_set1_epi32(int(i)));
+
+                // the variable shift by 32 bits gains zero
+                const __m512i from_shifted = _mm512_and_si512(
+                    _mm512_or_si512(_mm512_srlv_epi32(from_low, shift), _mm512_sllv_epi32(from_high, _mm512_sub_epi32(bit_size32, shift))),
+                    value_mask);
+
+                __m512i multiplied_value = _mm512_i32gather_epi32(_mm512_and_si512(from_shifted, byte_mask), (const int *)table_arr[0], 4);
+
+                multiplied_value = _mm512_add_epi32(multiplied_value,
+                    _mm512_i32gather_epi32(_mm512_and_si512(_mm512_srli_epi32(from_shifted, 8), byte_mask), (const int *)table_arr[1], 4));
+                multiplied_value = _mm512_add_epi32(multiplied_value,
+                    _mm512_i32gather_epi32(_mm512_and_si512(_mm512_srli_epi32(from_shifted, 16), byte_mask), (const int *)table_arr[2], 4));
+                multiplied_value = _mm512_add_epi32(multiplied_value,
+                    _mm512_i32gather_epi32(_mm512_srli_epi32(from_shifted, 24), (const int *)table_arr[3], 4));
+
+                // return only minimal positive value
+                multiplied_value = _mm512_max_epu32(multiplied_value, one);
+
+                _mm512_storeu_ps(multiplied_values_arr32 + i, _mm512_cvtepi32_ps(multiplied_value));
+            }
+        }
+    }
+
+    CORR_SIMD_TARGET("avx512f")
+    void calculate_corr_values_block_avx512(
+        const CorrValuesBlockParams & params, const float * multiplied_values_arr, const float * stream_corr_absmax_arr, size_t block_size,
+        float * corr_values_arr, CorrValuesBlockStats & stats)
+    {
+        const __m512 syncseq_corr_absmax = _mm512_set1_ps(params.syncseq_corr_absmax);
+        const __m512 corr_min = _mm512_set1_ps(params.corr_min);
+        const __m512 filtered_corr_value = _mm512_set1_ps(params.filtered_corr_value);
+
+        __m512 min_corr_value = _mm512_set1_ps(stats.min_corr_value);
+        __m512 max_corr_value = _mm512_set1_ps(stats.max_corr_value);
+
+        size_t i = 0;
+
+        for (; i + 16 <= block_size; i += 16) {
+            __m512 corr_value = _mm512_div_ps(_mm512_loadu_ps(multiplied_values_arr + i), _mm512_max_ps(syncseq_corr_absmax, _mm512_loadu_ps(stream_corr_absmax_arr + i)));
+
+            if (params.use_linear_corr) {
+                corr_value = _mm512_sqrt_ps(corr_value);
+            }
+
+            min_corr_value = _mm512_min_ps(min_corr_value, corr_value);
+            max_corr_value = _mm512_max_ps(max_corr_value, corr_value);
+
+            const __mmask16 is_not_filtered = _mm512_cmp_ps_mask(corr_value, corr_min, _CMP_GE_OQ);
+
+            _mm512_storeu_ps(corr_values_arr + i, _mm512_mask_blend_ps(is_not_filtered, filtered_corr_value, corr_value));
+
+            stats.num_corr_values_calc += count_bits16(uint32_t(is_not_filtered));
+        }
+
+        float min_corr_value_arr[16];
+        float max_corr_value_arr[16];
+
+        _mm512_storeu_ps(min_corr_value_arr, min_corr_value);
+        _mm512_storeu_ps(max_corr_value_arr, max_corr_value);
+
+        for (size_t j = 0; j < 16; j++) {
+            stats.min_corr_value = (std::min)(stats.min_corr_value, min_corr_value_arr[j]);
+            stats.max_corr_value = (std::max)(stats.max_corr_value, max_corr_value_arr[j]);
+        }
+
+        for (; i < block_size; i++) {
+            calculate_corr_value_scalar(params, multiplied_values_arr[i], stream_corr_absmax_arr[i], corr_values_arr[i], stats);
+        }
+    }
+
+    CORR_SIMD_TARGET("avx512f")
+    void calculate_autocorr_tile_avx512(
+        const float * corr_values_arr, size_t lag, size_t first, size_t last,
+        float * numerator_arr, uint32_t * num_corr_arr)
+    {
+        const size_t num_vectors = CORR_AUTOCORR_TILE_SIZE / 16;
+
+        const __m512 zero = _mm512_setzero_ps();
+        const __m512i one = _mm512_set1_epi32(1);
+
+        __m512 numerator[num_vectors];
+        __m512i num_corr[num_vectors];
+
+        for (size_t k = 0; k < num_vectors; k++) {
+            numerator[k] = _mm512_loadu_ps(numerator_arr + k * 16);
+            num_corr[k] = _mm512_loadu_si512(num_corr_arr + k * 16);
+        }
+
+        const float * shifted_corr_values_arr = corr_values_arr + lag;
+
+        for (size_t j = first; j < last; j++) {
+            const __m512 corr_value0 = _mm512_set1_ps(corr_values_arr[j]);
+
+            for (size_t k = 0; k < num_vectors; k++) {
+                const __m512 corr_value = _mm512_mul_ps(corr_value0, _mm512_loadu_ps(shifted_corr_values_arr + j + k * 16));
+
+                const __mmask16 is_not_zero = _mm512_cmp_ps_mask(corr_value, zero, _CMP_NEQ_UQ);
+
+                numerator[k] = _mm512_add_ps(numerator[k], _mm512_maskz_mul_ps(is_not_zero, corr_value, corr_value));
+                num_corr[k] = _mm512_mask_add_epi32(num_corr[k], is_not_zero, num_corr[k], one);
+            }
+        }
+
+        for (size_t k = 0; k < num_vectors; k++) {
+            _mm512_storeu_ps(numerator_arr + k * 16, numerator[k]);
+            _mm512_storeu_si512(num_corr_arr + k * 16, num_corr[k]);
+        }
+    }
+
+    inline void get_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (& regs)[4])
+    {
+#ifdef _MSC_VER
+        int regs_[4];
+        __cpuidex(regs_, int(leaf), int(subleaf));
+        for (size_t i = 0; i < 4; i++) {
+            regs[i] = uint32_t(regs_[i]);
+        }
+#else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    // extended control register of the OS enabled processor states, must be called only if the OSXSAVE bit is set
+    inline uint64_t get_xcr0()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+        return (uint64_t(edx) << 32) | eax;
+#endif
+    }
+#endif
+
+    const CorrSimdKernels s_corr_simd_kernels_arr[] = {
+        { Impl::simd_scalar, multiply_bits_block_scalar, calculate_corr_values_block_scalar, calculate_autocorr_tile_scalar, translate_bytes_scalar },
+#if CORR_SIMD_X86
+        { Impl::simd_sse42, multiply_bits_block_scalar, calculate_corr_values_block_sse42, calculate_autocorr_tile_sse42, translate_bytes_sse42 },
+        { Impl::simd_avx2, multiply_bits_block_avx2, calculate_corr_values_block_avx2, calculate_autocorr_tile_avx2, translate_bytes_avx2 },
+        // the byte shuffle of 512-bit vectors requires the AVX-512BW
+        { Impl::simd_avx512, multiply_bits_block_avx512, calculate_corr_values_block_avx512, calculate_autocorr_tile_avx512, translate_bytes_avx2 },
+#endif
+    };
+
+    const CorrSimdKernels * find_corr_simd_kernels(Impl::simd_token simd_token)
+    {
+        for (const auto & corr_simd_kernels : s_corr_simd_kernels_arr) {
+            if (corr_simd_kernels.simd_token == simd_token) {
+                return &corr_simd_kernels;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+bool is_corr_simd_supported(Impl::simd_token simd_token)
+{
+    if (!find_corr_simd_kernels(simd_token)) {
+        return false;
+    }
+
+    if (simd_token == Impl::simd_scalar) {
+        return true;
+    }
+
+#if CORR_SIMD_X86
+    uint32_t regs[4]; // eax, ebx, ecx, edx
+
+    get_cpuid(0, 0, regs);
+
+    const uint32_t max_leaf = regs[0];
+
+    if (max_leaf < 1) {
+        return false;
+    }
+
+    get_cpuid(1, 0, regs);
+
+    const bool has_sse42 = !!(regs[2] & (uint32_t(0x01) << 20));
+    const bool has_osxsave = !!(regs[2] & (uint32_t(0x01) << 27));
+    const bool has_avx = !!(regs[2] & (uint32_t(0x01) << 28));
+
+    bool has_avx2 = false;
+    bool has_avx512f = false;
+
+    if (max_leaf >= 7) {
+        get_cpuid(7, 0, regs);
+
+        has_avx2 = !!(regs[1] & (uint32_t(0x01) << 5));
+        has_avx512f = !!(regs[1] & (uint32_t(0x01) << 16));
+    }
+
+    // the OS must save the vector registers state: XMM and YMM, plus the opmask, upper ZMM0-15 and ZMM16-31 for the AVX-512
+    const uint64_t xcr0 = has_osxsave ? get_xcr0() : 0;
+
+    const bool has_os_avx = has_avx && (xcr0 & 0x06) == 0x06;
+    const bool has_os_avx512 = has_os_avx && (xcr0 & 0xe6) == 0xe6;
+
+    switch (simd_token) {
+    case Impl::simd_sse42:
+        return has_sse42;
+
+    case Impl::simd_avx2:
+        return has_sse42 && has_os_avx && has_avx2;
+
+    case Impl::simd_avx512:
+        return has_sse42 && has_os_avx512 && has_avx2 && has_avx512f;
+
+    default:;
+    }
+#endif
+
+    return false;
+}
+
+bool corr_simd_self_test(Impl::simd_token simd_token)
+{
+    const CorrSimdKernels * corr_simd_kernels_ptr = find_corr_simd_kernels(simd_token);
+    const CorrSimdKernels * corr_scalar_kernels_ptr = find_corr_simd_kernels(Impl::simd_scalar);
+
+    assert(corr_simd_kernels_ptr && corr_scalar_kernels_ptr);
+
+    if (!corr_simd_kernels_ptr || !corr_scalar_kernels_ptr) {
+        return false;
+    }
+
+    // pseudo random stream with the padding
+    const size_t stream_byte_size = CORR_BLOCK_BIT_SIZE / 8 * 4;
+
+    uint32_t stream_buf32[stream_byte_size / 4 + 1 + 1];
+
+    uint32_t random_value = 0x1d0af;
+
+    for (auto & value : stream_buf32) {
+        random_value = random_value * 1664525 + 1013904223;
+        value = random_value;
+    }
+
+    stream_buf32[stream_byte_size / 4] = 0;
+    stream_buf32[stream_byte_size / 4 + 1] = 0;
+
+    std::unique_ptr<CorrMultiplyTable> corr_multiply_table_ptr{ new CorrMultiplyTable };
+
+    float multiplied_values_arr[2][CORR_BLOCK_BIT_SIZE];
+    float stream_corr_absmax_arr[2][CORR_BLOCK_BIT_SIZE];
+    float corr_values_arr[2][CORR_BLOCK_BIT_SIZE];
+
+    const Impl::corr_multiply_method corr_mm_arr[] = { Impl::corr_muliply_inverted_xor_prime1033, Impl::corr_muliply_dispersed_value_prime1033 };
+    const uint32_t syncseq_bit_size_arr[] = { 1, 7, 20, 32 };
+    const size_t block_size_arr[] = { 1, 13, 32, 37, CORR_BLOCK_BIT_SIZE };
+    const float corr_min_arr[] = { 0, DEFAULT_QUADRATIC_CORR_MIN, DEFAULT_LINEAR_CORR_MIN };
+
+    for (const auto corr_mm : corr_mm_arr)
+    for (const auto syncseq_bit_size : syncseq_bit_size_arr) {
+        const uint32_t syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
+        const uint32_t syncseq_bytes = stream_buf32[1] & syncseq_mask;
+
+        make_corr_multiply_table(corr_mm, syncseq_bytes, syncseq_bit_size, *corr_multiply_table_ptr);
+
+        for (const auto block_size : block_size_arr)
+        for (size_t from = 0; from < 2; from++) {
+            const CorrSimdKernels * kernels_ptr_arr[2] = { corr_scalar_kernels_ptr, corr_simd_kernels_ptr };
+
+            for (size_t k = 0; k < 2; k++) {
+                kernels_ptr_arr[k]->multiply_bits_block(corr_multiply_table_ptr->syncseq_arr, stream_buf32 + from, syncseq_mask, block_size, multiplied_values_arr[k]);
+                kernels_ptr_arr[k]->multiply_bits_block(corr_multiply_table_ptr->stream_arr, stream_buf32 + from, syncseq_mask, block_size, stream_corr_absmax_arr[k]);
+            }
+
+            if (memcmp(multiplied_values_arr[0], multiplied_values_arr[1], block_size * sizeof(float)) ||
+                memcmp(stream_corr_absmax_arr[0], stream_corr_absmax_arr[1], block_size * sizeof(float))) {
+                return false;
+            }
+
+            const float syncseq_corr_absmax = multiply_bits(corr_multiply_table_ptr->syncseq_arr, syncseq_bytes);
+
+            for (const auto corr_min : corr_min_arr)
+            for (size_t use_linear_corr = 0; use_linear_corr < 2; use_linear_corr++) {
+                const CorrValuesBlockParams params{ syncseq_corr_absmax, corr_min, corr_min, !!use_linear_corr };
+
+                CorrValuesBlockStats stats_arr[2] = {
+                    { math::float_max, 0, 0 },
+                    { math::float_max, 0, 0 }
+                };
+
+                for (size_t k = 0; k < 2; k++) {
+                    kernels_ptr_arr[k]->calculate_corr_values_block(params, multiplied_values_arr[0], stream_corr_absmax_arr[0], block_size, corr_values_arr[k], stats_arr[k]);
+                }
+
+                if (memcmp(corr_values_arr[0], corr_values_arr[1], block_size * sizeof(float)) ||
+                    stats_arr[0].min_corr_value != stats_arr[1].min_corr_value ||
+                    stats_arr[0].max_corr_value != stats_arr[1].max_corr_value ||
+                    stats_arr[0].num_corr_values_calc != stats_arr[1].num_corr_values_calc) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // autocorrelation tiles over the correlation values with the filtered zero values
+
+    const size_t autocorr_values_size = CORR_AUTOCORR_TILE_SIZE * 4;
+
+    float autocorr_values_arr[autocorr_values_size];
+
+    for (auto & value : autocorr_values_arr) {
+        random_value = random_value * 1664525 + 1013904223;
+        value = (random_value >> 8) % 3 ? float(random_value >> 8) / float(0x01000000) : 0;
+    }
+
+    const size_t lag_arr[] = { 0, 1, 17, CORR_AUTOCORR_TILE_SIZE * 2 };
+
+    for (const auto lag : lag_arr) {
+        float numerator_arr[2][CORR_AUTOCORR_TILE_SIZE];
+        uint32_t num_corr_arr[2][CORR_AUTOCORR_TILE_SIZE];
+
+        const CorrSimdKernels * kernels_ptr_arr[2] = { corr_scalar_kernels_ptr, corr_simd_kernels_ptr };
+
+        for (size_t k = 0; k < 2; k++) {
+            std::fill(numerator_arr[k], numerator_arr[k] + CORR_AUTOCORR_TILE_SIZE, 0.0f);
+            std::fill(num_corr_arr[k], num_corr_arr[k] + CORR_AUTOCORR_TILE_SIZE, 0);
+
+            const size_t last = autocorr_values_size - lag - CORR_AUTOCORR_TILE_SIZE + 1;
+
+            // split range
+            kernels_ptr_arr[k]->calculate_autocorr_tile(autocorr_values_arr, lag, 0, last / 3, numerator_arr[k], num_corr_arr[k]);
+            kernels_ptr_arr[k]->calculate_autocorr_tile(autocorr_values_arr, lag, last / 3, last, numerator_arr[k], num_corr_arr[k]);
+        }
+
+        if (memcmp(numerator_arr[0], numerator_arr[1], sizeof(numerator_arr[0])) ||
+            memcmp(num_corr_arr[0], num_corr_arr[1], sizeof(num_corr_arr[0]))) {
+            return false;
+        }
+    }
+
+    // bytes translation by a pseudo random table with the bits out of the translated bits in the output buffer
+
+    BaudTranslateTable baud_translate_table;
+
+    for (size_t i = 0; i < 16; i++) {
+        random_value = random_value * 1664525 + 1013904223;
+        baud_translate_table.low_nibble_arr[i] = uint8_t((random_value >> 16) & 0x0f);
+        baud_translate_table.high_nibble_arr[i] = uint8_t(baud_translate_table.low_nibble_arr[i] << 4);
+    }
+
+    for (size_t i = 0; i < 256; i++) {
+        baud_translate_table.byte_arr[i] = uint8_t(baud_translate_table.low_nibble_arr[i & 0x0f] | baud_translate_table.high_nibble_arr[i >> 4]);
+    }
+
+    const size_t translate_byte_size = 128;
+
+    uint8_t translate_buf[translate_byte_size + 1];
+    uint8_t translate_out_buf[2][translate_byte_size + 1];
+
+    for (auto & value : translate_buf) {
+        random_value = random_value * 1664525 + 1013904223;
+        value = uint8_t(random_value >> 24);
+    }
+
+    const size_t translate_size_arr[] = { 1, 15, 16, 17, 33, 64, 65, translate_byte_size };
+
+    for (const auto translate_size : translate_size_arr)
+    for (uint32_t shifted_bit_offset = 0; shifted_bit_offset < 8; shifted_bit_offset++) {
+        const CorrSimdKernels * kernels_ptr_arr[2] = { corr_scalar_kernels_ptr, corr_simd_kernels_ptr };
+
+        for (size_t k = 0; k < 2; k++) {
+            memset(translate_out_buf[k], 0x5a, sizeof(translate_out_buf[k]));
+
+            kernels_ptr_arr[k]->translate_bytes(baud_translate_table, translate_buf, translate_size, shifted_bit_offset, translate_out_buf[k]);
+        }
+
+        if (memcmp(translate_out_buf[0], translate_out_buf[1], sizeof(translate_out_buf[0]))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Impl::simd_token get_corr_simd_default()
+{
+    static const Impl::simd_token s_simd_token = []() -> Impl::simd_token {
+        const Impl::simd_token simd_token_arr[] = { Impl::simd_avx512, Impl::simd_avx2, Impl::simd_sse42 };
+
+        for (const auto simd_token : simd_token_arr) {
+            if (is_corr_simd_supported(simd_token) && corr_simd_self_test(simd_token)) {
+                return simd_token;
+            }
+        }
+
+        return Impl::simd_scalar;
+    }();
+
+    return s_simd_token;
+}
+
+const CorrSimdKernels & get_corr_simd_kernels(Impl::simd_token simd_token)
+{
+    const CorrSimdKernels * corr_simd_kernels_ptr = find_corr_simd_kernels(simd_token != Impl::simd_unknown ? simd_token : get_corr_simd_default());
+
+    assert(corr_simd_kernels_ptr);
+
+    return corr_simd_kernels_ptr ? *corr_simd_kernels_ptr : s_corr_simd_kernels_arr[0];
+}
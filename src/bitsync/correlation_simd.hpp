@@ -0,0 +1,91 @@
+#pragma once
+
+#include "correlation.hpp"
+
+
+#define CORR_BLOCK_BIT_SIZE 64 // number of consecutive stream offsets to calculate correlation values by a block
+#define CORR_AUTOCORR_TILE_SIZE 32 // number of consecutive lags to calculate autocorrelation values by a tile
+#define CORR_AUTOCORR_TILES_PER_ITEM 4 // number of tiles to calculate by a thread work item
+#define CORR_AUTOCORR_BLOCK_SIZE 4096 // number of correlation values to calculate all tiles of a work item by a block
+
+
+struct CorrValuesBlockParams
+{
+    float                           syncseq_corr_absmax;
+    float                           corr_min;
+    float                           filtered_corr_value;            // a value to replace a correlation value filtered by the correlation minimum
+    bool                            use_linear_corr;
+};
+
+struct CorrValuesBlockStats
+{
+    float                           min_corr_value;
+    float                           max_corr_value;
+    size_t                          num_corr_values_calc;           // number of correlation values excluding filtered values by correlation minimum
+};
+
+// Translation table of the bytes of the bauds of 1 or 2 bits, where a nibble is always translated into a nibble.
+//
+struct BaudTranslateTable
+{
+    uint8_t                         byte_arr[256];
+    uint8_t                         low_nibble_arr[16];             // translated low nibble
+    uint8_t                         high_nibble_arr[16];            // translated high nibble in the high nibble
+};
+
+// Correlation values calculation kernels by a block of consecutive stream offsets.
+//
+struct CorrSimdKernels
+{
+    Impl::simd_token                simd_token;
+
+    // Calculates the `multiply_bits` values of a block by the table.
+    // The block size must be not greater than `CORR_BLOCK_BIT_SIZE`, the values beyond the block size up to a multiple of 32 are calculated from the padding.
+    //
+    void (* multiply_bits_block)(
+        const uint32_t (& table_arr)[4][256], const uint32_t * stream_buf32, uint32_t syncseq_mask, size_t block_size,
+        float * multiplied_values_arr);
+
+    // Calculates the `calculate_corr_value` values of a block with the correlation minimum filter.
+    //
+    void (* calculate_corr_values_block)(
+        const CorrValuesBlockParams & params, const float * multiplied_values_arr, const float * stream_corr_absmax_arr, size_t block_size,
+        float * corr_values_arr, CorrValuesBlockStats & stats);
+
+    // Accumulates the autocorrelation numerator values and the numbers of not zero products of a tile of `CORR_AUTOCORR_TILE_SIZE` consecutive lags
+    // beginning from the lag over the correlation values range [first; last):
+    //
+    //   numerator_arr[t] += (corr_values_arr[j] * corr_values_arr[j + lag + t]) ^ 2
+    //   num_corr_arr[t] += corr_values_arr[j] * corr_values_arr[j + lag + t] != 0
+    //
+    //  Each lag is accumulated in the order of the correlation values, so the result does not depend on the range split.
+    //
+    void (* calculate_autocorr_tile)(
+        const float * corr_values_arr, size_t lag, size_t first, size_t last,
+        float * numerator_arr, uint32_t * num_corr_arr);
+
+    // Translates the bytes of the bit stream shifted by the bit offset in range [0; 7] by the table:
+    //
+    //   buf_out bits [k * 8 + shifted_bit_offset; k * 8 + shifted_bit_offset + 8) = byte_arr[buf bits [k * 8 + shifted_bit_offset; ...)], k in [0; size)
+    //
+    //  The bits out of the translated bits are not changed in the output buffer. The input buffer must be padded by a byte, the output buffer must be
+    //  padded by a byte if the bit offset is not 0.
+    //
+    void (* translate_bytes)(
+        const BaudTranslateTable & table, const uint8_t * buf, size_t size, uint32_t shifted_bit_offset,
+        uint8_t * buf_out);
+};
+
+bool is_corr_simd_supported(Impl::simd_token simd_token);
+
+// Checks the kernels of an instruction set against the scalar kernels, the instruction set must be supported.
+//
+bool corr_simd_self_test(Impl::simd_token simd_token);
+
+// Returns the best supported instruction set with passed self test. Evaluates only once.
+//
+Impl::simd_token get_corr_simd_default();
+
+// Returns the kernels of an instruction set, the `simd_unknown` is replaced by the `get_corr_simd_default` result.
+//
+const CorrSimdKernels & get_corr_simd_kernels(Impl::simd_token simd_token);
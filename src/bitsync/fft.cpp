@@ -0,0 +1,124 @@
+// Author: Andrey Dibrov (andry at inbox dot ru)
+//
+
+#include "fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+void fft_transform(std::complex<double> * data_arr, size_t size, bool inverse)
+{
+    if (size < 2) {
+        return;
+    }
+
+    // bit reversal permutation
+
+    for (size_t i = 1, j = 0; i < size; i++) {
+        size_t bit = size >> 1;
+
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+
+        j ^= bit;
+
+        if (i < j) {
+            std::swap(data_arr[i], data_arr[j]);
+        }
+    }
+
+    // twiddle factors of the last stage, each calculated directly to avoid the error accumulation
+
+    const double pi = 3.14159265358979323846;
+
+    std::vector<std::complex<double> > twiddle_arr(size / 2);
+
+    for (size_t k = 0; k < size / 2; k++) {
+        const double angle = (inverse ? 2 : -2) * pi * double(k) / double(size);
+
+        twiddle_arr[k] = std::complex<double>{ std::cos(angle), std::sin(angle) };
+    }
+
+    // butterflies
+
+    for (size_t len = 2; len <= size; len <<= 1) {
+        const size_t half_len = len / 2;
+        const size_t twiddle_step = size / len;
+
+        for (size_t i = 0; i < size; i += len) {
+            std::complex<double> * first_half_arr = data_arr + i;
+            std::complex<double> * second_half_arr = first_half_arr + half_len;
+
+            for (size_t k = 0; k < half_len; k++) {
+                const std::complex<double> u = first_half_arr[k];
+                const std::complex<double> v = second_half_arr[k] * twiddle_arr[k * twiddle_step];
+
+                first_half_arr[k] = u + v;
+                second_half_arr[k] = u - v;
+            }
+        }
+    }
+}
+
+void calculate_fft_autocorr_pair(
+    const double *  first_arr,
+    const double *  second_arr,
+    size_t          size,
+    size_t          num_lags,
+    double *        first_autocorr_arr,
+    double *        second_autocorr_arr)
+{
+    num_lags = (std::min)(num_lags, size);
+
+    if (!num_lags) {
+        return;
+    }
+
+    // zero padding to avoid the circular wrap of lags
+    size_t fft_size = 2;
+
+    while (fft_size < size + num_lags - 1) {
+        fft_size <<= 1;
+    }
+
+    std::vector<std::complex<double> > data_arr(fft_size);
+
+    for (size_t i = 0; i < size; i++) {
+        data_arr[i] = std::complex<double>{ first_arr[i], second_arr[i] };
+    }
+
+    fft_transform(data_arr.data(), fft_size, false);
+
+    // Split the spectrums and calculate the power spectrums of both sequences:
+    //
+    //   F[k] = (X[k] + conj(X[N - k])) / 2
+    //   S[k] = (X[k] - conj(X[N - k])) / 2i
+    //
+    //  The power spectrums are real, so they are stored back as the real and the imaginary parts.
+    //
+
+    for (size_t k = 0; k <= fft_size / 2; k++) {
+        const size_t nk = (fft_size - k) & (fft_size - 1);
+
+        const std::complex<double> x_k = data_arr[k];
+        const std::complex<double> x_nk = data_arr[nk];
+
+        const std::complex<double> first_k = (x_k + std::conj(x_nk)) * 0.5;
+        const std::complex<double> second_k = (x_k - std::conj(x_nk)) * std::complex<double>{ 0, -0.5 };
+
+        // the power spectrums are even, so the values of `k` and `N - k` are equal
+        const std::complex<double> power_k{ std::norm(first_k), std::norm(second_k) };
+
+        data_arr[k] = power_k;
+        data_arr[nk] = power_k;
+    }
+
+    fft_transform(data_arr.data(), fft_size, true);
+
+    for (size_t lag = 0; lag < num_lags; lag++) {
+        first_autocorr_arr[lag] = data_arr[lag].real() / double(fft_size);
+        second_autocorr_arr[lag] = data_arr[lag].imag() / double(fft_size);
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+
+// In place radix-2 complex FFT, where the size must be a power of 2. The inverse transform is not scaled by the size.
+//
+//  Memory complexity:   O(N)
+//  Time complexity:     O(N * ln(N))
+//
+void fft_transform(std::complex<double> * data_arr, size_t size, bool inverse);
+
+// Calculates not circular autocorrelations of 2 real sequences at once by a single forward and a single inverse complex FFT:
+//
+//   autocorr_arr[lag] = sum(arr[j] * arr[j + lag]), j in [0; size - lag), lag in [0; num_lags)
+//
+//  The first sequence is the real part and the second sequence is the imaginary part of the input. Because the spectrum of a real sequence is
+//  conjugate symmetric, the spectrums of both sequences are split back from the spectrum of the input.
+//
+void calculate_fft_autocorr_pair(
+    const double *  first_arr,
+    const double *  second_arr,
+    size_t          size,
+    size_t          num_lags,
+    double *        first_autocorr_arr,
+    double *        second_autocorr_arr);
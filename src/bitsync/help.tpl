@@ -4,7 +4,13 @@
 
 Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode> [<BitsPerBaud>] <InputFile> [<OutputFileDir> | <OutputFile>]
        [+ AppModuleName +].exe [/?] [<Flags>] [//] sync <InputFile> [<OutputFileDir>]
+       [+ AppModuleName +].exe [/?] [<Flags>] [/stream-chunk-byte-size ...] [//] sync-stream <InputFile>
+       [+ AppModuleName +].exe [/?] [<Flags>] [/track-max-misses ...] [//] sync-track <InputFile>
+       [+ AppModuleName +].exe [/?] [<Flags>] [/stream-max-period ...] [//] sync-window <InputFile>
+       [+ AppModuleName +].exe [/?] [<Flags>] [/threads ...] [//] sync-batch <InputFile>...
        [+ AppModuleName +].exe [/?] [<Flags>] [/gen-token ...] [//] gen <BitsPerBaud> <InputFile> [<OutputFileDir>]
+       [+ AppModuleName +].exe [/?] [<Flags>] [/gen-token ...] [//] gen-sync <BitsPerBaud> <InputFile>
+       [+ AppModuleName +].exe [/?] [<Flags>] [/remap-sync-variants ...] [//] sync-remap <BitsPerBaud> <InputFile>
        [+ AppModuleName +].exe [/?] [<Flags>] [/gen-input-noise ...] [//] pipe <InputFile> <OutputFile>
 
   Description:
@@ -84,7 +90,40 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
 
           Can not be used together with another `/impl-*` options.
 
-        Has meaning only for these modes: sync | gen-sync.
+        /impl-token ensemble-of-corr-mean
+        /impl-eocm
+
+          Calculate through both the maximum weighted sum of correlation mean
+          values and the minimum sum of correlation mean deviation values.
+
+          Algorithm:
+            Phase 1:   Calculate correlation values.
+            Phase 2:   Calculate correlation mean values and correlation
+                       mean deviation values by a single pass.
+            Phase 3.1: Calculate maximum weighted sum of correlation mean
+                       values.
+            Phase 3.2: Calculate minimum sum of correlation mean deviation
+                       values.
+
+          Major time complexity: N * N * ln(N)
+            , where N - stream bit length
+
+          The offset and the period are of the maximum weighted sum of
+          correlation mean values. The offset and the period of the minimum
+          sum of correlation mean deviation values are printed separately
+          together with the agreement of both results.
+
+          Pros:
+            * Faster than the both implementations invoked separately, the
+              results are the same.
+
+          Cons:
+            * Needs the correlation mean values buffer for each of the both
+              implementations.
+
+          Can not be used together with another `/impl-*` options.
+
+        Has meaning only for these modes: sync | gen-sync | sync-remap.
 
       /corr-multiply-method <token>
       /corr-mm <token>
@@ -117,7 +156,63 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
           Can not be used together with another `/corr-multiply-method`
           option.
 
-        Has meaning only for these modes: sync | gen-sync.
+        Has meaning only for these modes: sync | gen-sync | sync-remap.
+
+      /simd-token <token>
+        Instruction set of the correlation values and the direct
+        autocorrelation values calculation and of the bauds translation of
+        the generated stream.
+
+        By default the best instruction set is selected at runtime from
+        those supported by the processor and which has passed the self test
+        against the scalar code.
+
+        All instruction sets does produce the same correlation values.
+
+        /simd-token scalar
+
+          No vector instructions.
+
+        /simd-token sse42
+
+          SSE4.2 instructions, processes 4 values at once.
+
+        /simd-token avx2
+
+          AVX2 instructions, processes 8 values at once.
+
+        /simd-token avx512
+
+          AVX-512F instructions, processes 16 values at once.
+          The bauds translation uses the AVX2 instructions.
+
+        Can not be used together with another `/simd-token` option.
+
+        Has meaning only for these modes: gen | sync | gen-sync | sync-remap.
+
+      /corr-value-token <token>
+        Storage type of the correlation values.
+
+        The fixed point types reduces the memory consumption of the
+        correlation values by 2 or 4 times, so the longer stream can be
+        processed within the same processor cache or memory. The correlation
+        minimum filter (`/corr-min`) is applied to the fixed point values.
+
+        /corr-value-token float32
+
+          32-bit float values (default).
+
+        /corr-value-token fixed16
+
+          16-bit fixed point values with the precision of 1/65535.
+
+        /corr-value-token fixed8
+
+          8-bit fixed point values with the precision of 1/255.
+
+        Can not be used together with another `/corr-value-token` option.
+
+        Has meaning only for these modes: sync | gen-sync | sync-remap.
 
       /no-zero-corr
         Avoid zero correlation values replacing them by `/corr-min` or by a
@@ -135,6 +230,26 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
         linear distribution. If not defined, then use quadratic correlation
         values as is.
 
+      /use-comb-corr-sum
+        Calculate the sums of correlation values of all the offsets of a period
+        by a sliding comb: the sum of an offset is calculated from the sum of
+        the offset a period before by add of the newest repeat and subtract of
+        the one that falls out. So the time of the correlation mean values
+        calculation does not depend on the maximum number of repeats
+        (`/syncseq-max-repeat`).
+
+        Has effect only if `/max-periods-in-offset` is not 0, otherwise there
+        is only one offset for each remainder of a period.
+
+        Has meaning if the algorithm of maximum weighted sum of correlation
+        mean values or the algorithm of minimum sum of correlation mean
+        deviation values is used.
+
+        NOTE:
+          The float correlation values (`/corr-value-token float32`) are
+          summed with the double precision, so the correlation mean values can
+          slightly differ from the values calculated without this flag.
+
       /use-max-corr-mean
       /skip-max-weighted-sum-of-corr-mean-calc
       /skip-mwsocm-calc
@@ -177,8 +292,9 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
       /s <size>
         Stream size in bytes to process.
 
-        In case of `sync` mode must be greater than 4 bytes (32 bits) and less
-        than 2^32 bytes.
+        In case of `sync` mode must be greater than 4 bytes (32 bits). Is not
+        limited by 2^32 bytes, the offsets are 64-bit and the results of a
+        stream less than 2^32 bits are stored in a compact 32-bit layout.
 
         CAUTION:
           To sync must be enough to fit the real stream period, otherwise the
@@ -186,6 +302,18 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
           and period will be inaccurate or incorrect independently to the
           input noise.
 
+        In case of `sync-stream` mode is the sliding window size, must be
+        greater than 4 bytes (32 bits) and less than 2^32 bytes. If not
+        defined, then calculates from the `/stream-max-period` parameter
+        multiplied by the maximum repeat quantity plus 1.
+
+        In case of `sync-window` mode is the window size, must be greater
+        than the windows overlap and less than 2^31 bytes. If not defined,
+        then is the double of the windows overlap.
+
+        In case of `sync-batch` mode limits the stream size of each input
+        file. If not defined, then the whole input file is read.
+
       /stream-bit-size <size>
       /si <size>
         Stream size in bits to process. The same as `/stream-byte-size` but as
@@ -282,15 +410,24 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
 
         Default value is `16`.
 
-      /syncseq-bit-size <value>
-      /q <value>
+      /syncseq-bit-size <value>[,<value>...]
+      /q <value>[,<value>...]
         Synchro sequence (synchro mark) size in bits (must be less or equal
         to 32 bits).
+        A list of values is a size per synchro sequence of `/syncseq-int32`,
+        a single value is a size of all synchro sequences.
 
-      /syncseq-int32 <value>
-      /k <value>
+      /syncseq-int32 <value>[,<value>...]
+      /k <value>[,<value>...]
         Synchro sequence value to search for (must be not 0).
         The `<value>` is an integer positive 32-bit number.
+        A list of values does search for multiple synchro sequences, where the
+        correlation values of all synchro sequences are calculated by a single
+        pass over the stream and the rest calculation of each synchro sequence
+        is made in parallel by `/threads`. The result is of the synchro
+        sequence with the maximum correlation mean value, the results of each
+        synchro sequence are printed before.
+        Has meaning for the list only for these modes: sync.
 
       /syncseq-min-repeat <value>
       /r <value>
@@ -336,7 +473,7 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
         <bit-shift>               : 0-1
         <combination-index>       : 0-23
 
-        Has meaning only for these modes: gen | gen-sync.
+        Has meaning only for these modes: gen | gen-sync | sync-remap.
 
       /gen-input-noise <bit-block-size> <probability-per-block>
       /inn <bit-block-size> <probability-per-block>
@@ -349,7 +486,8 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
         <probability-per-block>   : 1-100
           Probability for a single bit inversion in each bits block.
 
-        Has meaning only for these modes: gen | sync | pipe | gen-sync.
+        Has meaning only for these modes: gen | sync | pipe | gen-sync |
+        sync-remap.
 
         Examples:
 
@@ -368,7 +506,7 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
         If <repeat> is defined, then does repeat the insert that set of times,
         otherwise repeat until the end of stream.
 
-        Has meaning only for these modes: gen | pipe | gen-sync.
+        Has meaning only for these modes: gen | pipe.
 
       /fill-output-syncseq <first_offset>[:<end_offset>] <period>[:<repeat>]
       /outssf <first_offset>[:<end_offset>] <period>[:<repeat>]
@@ -410,6 +548,45 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
 
         Default value is `0.81`.
 
+      /track-drift-bit-size <value>
+        Maximal drift in bits of the synchro sequence offset from the expected
+        offset of the next period in the `sync-track` mode. The offset of the
+        maximum correlation value in the drift range is used as the next
+        expected offset, where the lesser drift has a priority.
+
+        Limited by the half of the period.
+
+        Default value is 2.
+
+      /track-max-misses <value>
+        Number of consecutive checks of the `sync-track` mode with the
+        correlation value less than `/track-corr-min` to drop the lock and
+        acquire it again. Must be positive.
+
+        Default value is 3.
+
+      /track-corr-min <value>
+        Correlation minimum floating point value of a check in the
+        `sync-track` mode.
+
+        CAUTION:
+          Must be greater than the `/corr-min` option, because the maximum of
+          the correlation values of a random stream in the drift range is
+          often greater than the `/corr-min`, so the lock would not be
+          dropped.
+
+        Must be in range [0.0; 1.0].
+
+        Default value is `0.8` and `0.89` if the `/use-linear-corr` is used.
+
+      /stream-chunk-byte-size <size>
+      /sc <size>
+        Stream chunk size in bytes to read in the `sync-stream` mode. The lock
+        is evaluated after each chunk, so a lesser chunk does decrease the
+        lock latency, but increases the evaluation overhead.
+
+        Default value is 4096.
+
       /skip-calc-on-filtered-corr-value-use
       /skip-calc-on-fcvu
         Skip calculation if a filtered correlation value is used (filtered by
@@ -434,28 +611,188 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
           values would be not enough and the calculated offset and period may
           be inaccurate or incorrect independently to the input noise.
 
+        The buffer is allocated once by the number of periods multiplied by
+        the `/max-corr-values-per-period` parameter, but not greater than this
+        value plus the values of a single period. Each value takes 20 bytes.
+        The ensemble implementation does allocate a buffer for each result.
+
+        In case of `sync-stream` mode limits the sliding window buffers, where
+        the window takes 2 bytes per bit and the sums of the periods take
+        8 bytes per offset of each period.
+
+        In case of `sync-window` mode limits the buffer of each window.
+
         Default value is 400MB.
 
-    If `/stream-byte-size` option is not used, then the whole input is read
-    but less than 2^32 bytes.
+      /threads <value>
+        Number of threads to calculate the correlation mean values, where a
+        thread takes the next period in the order of periods and waits while
+        the period is ahead of the last merged period by 2 periods per
+        thread, so the results of not more than 2 periods per thread are
+        held in memory out of the `/corr-mean-buf-max-size-mb` limit. The
+        sort of the results is split between the threads too.
+
+        In case of the algorithm of maximum weighted autocorrelation of
+        correlation values the tiles of autocorrelation lags are distributed
+        between the threads.
+
+        The result does not depend on the number of threads.
+
+        Has meaning if the algorithm of maximum weighted sum of correlation
+        mean values, the algorithm of minimum sum of correlation mean
+        deviation values or the algorithm of maximum weighted autocorrelation
+        of correlation values is used.
+
+        In case of `sync-stream` mode the periods of the sliding window are
+        distributed between the threads.
+
+        In case of `sync-window` mode the windows are distributed between the
+        threads, where each thread reads and calculates a single window at a
+        time, so the memory is limited by the window buffers multiplied by
+        the number of threads.
+
+        In case of `sync-batch` mode the input files are distributed between
+        the threads, where each thread reuses its buffer for the input files.
+
+        In case of `gen` mode the variants of each input chunk are
+        distributed between the threads.
+
+        `0` - use all the processor hardware threads.
+
+        The value is limited by 1024.
 
-    <Mode>: gen | sync | pipe | gen-sync
-      gen       - generation mode, multiple output.
-      sync      - synchronization mode, single output.
-      pipe      - pipe mode, connects a single input with a single output.
-      gen-sync  - generation and synchronization mode, single output.
+        Default value is 1.
 
-      NOTE:
-        The `get-sync` mode is not yet implemented.
+      /autocorr-fft-min-size <value>
+        Minimal number of correlation values to calculate the autocorrelation
+        values through the FFT instead of the direct loop. The FFT is used
+        only if it has less operations than the direct loop.
+
+        The result is the same within the float calculation tolerance.
+
+        Has meaning if the algorithm of maximum weighted autocorrelation of
+        correlation values is used.
+
+        `0` - no limit.
+
+        Default value is 65536.
+
+      /remap-sync-variants <value>
+        Number of the best ranked variants of the `sync-remap` mode to
+        generate and synchronize as the `gen-sync` mode.
+
+        `0` - only the ranking.
+
+        Default value is 1.
+
+    If `/stream-byte-size` option is not used, then the whole input is read
+    but less than 2^32 bytes. In case of `sync` mode the whole input is read
+    without the limit.
+
+    <Mode>: gen | sync | sync-stream | sync-track | sync-window | sync-batch | pipe | gen-sync | sync-remap
+      gen         - generation mode, multiple output.
+      sync        - synchronization mode, single output.
+      sync-stream - streaming synchronization mode over a not bounded input.
+      sync-track  - streaming synchronization mode with the lock tracking.
+      sync-window - synchronization mode of each window of the input.
+      sync-batch  - synchronization mode of each input file, multiple input.
+      pipe        - pipe mode, connects a single input with a single output.
+      gen-sync    - generation and synchronization mode, no output files.
+      sync-remap  - synchronization mode of the best ranked variants.
+
+      The `gen` mode reads the input once by chunks and each chunk is
+      translated and written into the output file of each variant. The
+      input noise is generated once for all the variants.
+
+      The `sync-stream` mode reads the input by chunks (`-` - standard input)
+      and calculates the correlation values only for the new offsets. The
+      correlation values of the last `/stream-byte-size` bytes (window) and
+      the sums of each period are updated incrementally, so the memory does
+      not grow with the input. Each lock change of the window is printed as a
+      record:
+
+        stream bit <N>: offset/period/confidence: <offset> / <period> / <mean>
+
+      , where `<offset>` is the absolute stream offset and `-` is printed if
+      the window is not locked.
+
+      The `sync-track` mode does acquire the lock as the `sync-stream` mode,
+      but after the lock acquisition stops to update the window and checks
+      only a single correlation value per period in the drift range around
+      the expected offset (see `/track-drift-bit-size` option), so the
+      calculation per period does not depend on the number of periods. The
+      drift of the offset is printed as a lock change record, where the
+      `<offset>` is the last checked offset and the `<mean>` does include the
+      values of the checks. The lock is dropped and acquired again after the
+      `/track-max-misses` consecutive checks less than `/track-corr-min`.
+
+      The `sync-window` mode splits the whole input into the windows of
+      `/stream-byte-size` bytes overlapped by the `/stream-max-period`
+      multiplied by the maximum repeat quantity bits, and synchronizes each
+      window as the `sync` mode independently. The last window is aligned to
+      the end of the input. The result of each window is printed as a
+      timeline record in the window order:
+
+        window <N> bit <begin>-<end>: offset/period/corr mean/drift: <offset> / <period> / <mean> / <drift>
+
+      , where `<offset>` is the absolute stream offset, `<drift>` is the
+      offset difference with the previous window by the modulo of the same
+      period and `-` is printed if not found. The period change between the
+      windows is marked by the `[PERIOD CHANGE]` suffix. The input noise is
+      generated by the absolute stream offset of each window.
+
+      The `sync-batch` mode synchronizes each input file as the `sync` mode
+      in a single process with the same options. The input file can be a
+      wildcard pattern (`*` and `?`) of the file name, which is expanded in
+      the file name order. The result of each input file is printed as a
+      record in the input files order:
+
+        <InputFile>: offset/period/corr mean: <offset> / <period> / <mean>
+
+      , where `-` is printed if not found. A not processed input file is
+      marked by the `[ERROR]` suffix, the rest input files are processed and
+      the exit code is 255.
+
+      The `gen-sync` mode reads the whole input once and generates each
+      variant of the `gen` mode into memory (the not remapped input is the
+      `#0-0` variant), and synchronizes each variant as the `sync` mode. The
+      variants are distributed between the threads. The result of each
+      variant is printed as a record ranked by the correlation mean value
+      from maximum to minimum:
+
+        #<bit-shift>-<combination-index>: offset/period/corr mean: <offset> / <period> / <mean>
+
+      , where `-` is printed if not found. The not found variants are
+      printed at the end. The input noise is generated once for all the
+      variants.
+
+      The `sync-remap` mode does not generate the variants to rank them.
+      Instead the synchro sequence is remapped by the inverse baud alphabet
+      sequence of each variant and the correlation values of all the
+      remapped synchro sequences are calculated by a single pass over the
+      input. The bits of a partial baud at the synchro sequence bounds are
+      not compared. Each variant is printed as a record ranked by the mean
+      of the top correlation values from maximum to minimum, where the
+      number of the top values is the minimal number of the synchro
+      sequence repeats in the input:
+
+        #<bit-shift>-<combination-index>: remapped syncseq/max corr offset/max corr/top corr mean: <syncseq> / <offset> / <max> / <mean>
+
+      , where `<syncseq>` is the remapped synchro sequence beginning from a
+      baud. After that the `/remap-sync-variants` best ranked variants are
+      generated and synchronized as the `gen-sync` mode.
 
     <BitsPerBaud>
       Bits per baud in stream (must be <= 2).
 
-      Has meaning only for these modes: gen | gen-sync.
+      Has meaning only for these modes: gen | gen-sync | sync-remap.
 
     <InputFile>
       Input file path.
 
+      In case of `sync-batch` mode can be repeated and can be a wildcard
+      pattern.
+
     <OutputFileDir>
       Output directory path for output files (current directory if not set).
 
@@ -468,10 +805,10 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
     * [single input] -> [generation] -> [single output]      (`pipe` or `gen`
                                                               + `gen-token`)
     * [single input] -> [synchronization] -> [single output] (`sync`)
-    * [single input] -> [generation] -> [multiple output] ->
-      -> [synchronization] -> [multiple output]              (`gen-sync`)
-    * [single input] -> [generation] -> [single output] ->
-      -> [synchronization] -> [single output]                (`gen-sync` +
+    * [single input] -> [generation] -> [multiple in-memory] ->
+      -> [synchronization] -> [ranked results]               (`gen-sync`)
+    * [single input] -> [generation] -> [single in-memory] ->
+      -> [synchronization] -> [single result]                (`gen-sync` +
                                                               `gen-token`)
 
     , where:
@@ -500,7 +837,10 @@ Usage: [+ AppModuleName +].exe [/?] [<Flags>] [/impl-token <token>] [//] <Mode>
     * Can work in the `sync` mode to use an externally generated stream
       variant as the input.
 
-    * (Not implemented) Can work in the `gen-sync` mode, where does execute
-      both stages the generation and the synchronization, and all the
-      intermediate operations does use the memory instead of files to produce
-      an output.
+    * Can work in the `gen-sync` mode, where does execute both stages the
+      generation and the synchronization, and all the intermediate
+      operations does use the memory instead of files to produce an output.
+
+    * Can work in the `sync-remap` mode to search all the variants by the
+      remapped synchro sequence in the input without the variants
+      generation.
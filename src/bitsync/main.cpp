@@ -3,13 +3,18 @@
 #include <tacklelib/utility/preprocessor.hpp>
 
 #include <inttypes.h>
+#include <io.h>
+#include <fcntl.h>
 
 
 const TCHAR * g_flags_to_parse_arr[] = {
-    _T("/impl-token"), _T("/impl-mwsocm"), _T("/impl-msocmd"), _T("/impl-mwacocv"),
+    _T("/impl-token"), _T("/impl-mwsocm"), _T("/impl-msocmd"), _T("/impl-mwacocv"), _T("/impl-eocm"),
     _T("/corr-multiply-method"), _T("/corr-mm"), _T("/corr-mm-inverted-xor-prime1033"), _T("/corr-mm-dispersed-value-prime1033"),
+    _T("/simd-token"),
+    _T("/corr-value-token"),
     _T("/stream-byte-size"), _T("/s"),
     _T("/stream-bit-size"), _T("/si"),
+    _T("/stream-chunk-byte-size"), _T("/sc"),
     _T("/syncseq-bit-size"), _T("/q"),
     _T("/syncseq-int32"), _T("/k"),
     _T("/syncseq-min-repeat"), _T("/r"),
@@ -25,14 +30,21 @@ const TCHAR * g_flags_to_parse_arr[] = {
     _T("/tee-input"),
     _T("/corr-min"),
     _T("/corr-mean-min"),
+    _T("/track-drift-bit-size"),
+    _T("/track-max-misses"),
+    _T("/track-corr-min"),
     _T("/no-zero-corr"),
     _T("/skip-calc-on-filtered-corr-value-use"), _T("/skip-calc-on-fcvu"),
+    _T("/use-comb-corr-sum"),
     _T("/skip-max-weighted-sum-of-corr-mean-calc"), _T("/skip-mwsocm-calc"),
     _T("/use-linear-corr"),
     _T("/use-max-corr-mean"),
     _T("/sort-at-first-by-max-corr-mean"),
     _T("/return-sorted-result"),
-    _T("/corr-mean-buf-max-size-mb")
+    _T("/corr-mean-buf-max-size-mb"),
+    _T("/threads"),
+    _T("/autocorr-fft-min-size"),
+    _T("/remap-sync-variants")
 };
 
 const TCHAR * g_empty_flags_arr[] = {
@@ -77,6 +89,140 @@ inline bool is_arg_equal_to(const TCHAR * arg, const TCHAR (& cmp_arg)[N])
     return !tstrncmp(arg, cmp_arg, N);
 }
 
+// Matches a file name with a wildcard pattern, where `*` - any number of any characters, `?` - any character. Is case insensitive as the Windows
+// shell.
+//
+inline bool is_wildcard_match(const TCHAR * str, const TCHAR * pattern)
+{
+    const TCHAR * star_pattern = nullptr;
+    const TCHAR * star_str = nullptr;
+
+    while (*str) {
+        if (*pattern == _T('*')) {
+            star_pattern = ++pattern;
+            star_str = str;
+        }
+        else if (*pattern == _T('?') || _totlower(*pattern) == _totlower(*str)) {
+            pattern++;
+            str++;
+        }
+        else if (star_pattern) {
+            // the last `*` takes one more character
+            pattern = star_pattern;
+            str = ++star_str;
+        }
+        else {
+            return false;
+        }
+    }
+
+    while (*pattern == _T('*')) {
+        pattern++;
+    }
+
+    return !*pattern;
+}
+
+// Appends the regular files of the directory matched with the wildcards of the file name of the path in the file name order. The path without the
+// wildcards is appended as is. Returns false if nothing is appended.
+//
+inline bool expand_input_file_pattern(const tackle::path_tstring & file_pattern, std::vector<tackle::path_tstring> & input_file_arr)
+{
+    const boost::fs::path file_pattern_path{ file_pattern.str() };
+    const std::tstring file_name_pattern = file_pattern_path.filename().tstring();
+
+    if (file_name_pattern.find_first_of(_T("*?")) == std::tstring::npos) {
+        if (!utility::is_regular_file(file_pattern, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, false)) {
+            return false;
+        }
+
+        input_file_arr.push_back(file_pattern);
+
+        return true;
+    }
+
+    const boost::fs::path dir_path = file_pattern_path.parent_path();
+
+    std::vector<std::tstring> file_name_arr;
+
+    boost::system::error_code ec;
+
+    for (boost::fs::directory_iterator it{ !dir_path.empty() ? dir_path : boost::fs::path{ _T(".") }, ec }, end_it; !ec && it != end_it; it.increment(ec)) {
+        if (!boost::fs::is_regular_file(it->status())) {
+            continue;
+        }
+
+        const std::tstring file_name = it->path().filename().tstring();
+
+        if (is_wildcard_match(file_name.c_str(), file_name_pattern.c_str())) {
+            file_name_arr.push_back(file_name);
+        }
+    }
+
+    if (file_name_arr.empty()) {
+        return false;
+    }
+
+    // the directory iteration order is not defined, so sort in the case insensitive order of the file names matching, where the case sensitive order is
+    // left for the names different only by a case
+    std::sort(file_name_arr.begin(), file_name_arr.end(), [](const std::tstring & l, const std::tstring & r) -> bool {
+        const int cmp = _tcsicmp(l.c_str(), r.c_str());
+        return cmp < 0 || (!cmp && l < r);
+    });
+
+    for (const auto & file_name : file_name_arr) {
+        input_file_arr.push_back(tackle::path_tstring{ (dir_path / file_name).tstring() });
+    }
+
+    return true;
+}
+
+// Splits a comma separated list of numbers, where each number is converted by the function.
+//
+template <typename T, typename Func>
+inline void parse_number_list(const TCHAR * arg, std::vector<T> & number_arr, Func to_number)
+{
+    number_arr.clear();
+
+    const std::tstring list_str{ arg };
+
+    for (size_t pos = 0;;) {
+        const size_t next_pos = list_str.find(_T(','), pos);
+        const std::tstring number_str = list_str.substr(pos, next_pos != std::tstring::npos ? next_pos - pos : std::tstring::npos);
+
+        number_arr.push_back(to_number(number_str.c_str()));
+
+        if (next_pos == std::tstring::npos) {
+            break;
+        }
+
+        pos = next_pos + 1;
+    }
+}
+
+// Converts a decimal number without a sign, where the number is saturated by the 32-bit maximum. Returns false if the string is not a number.
+//
+inline bool parse_unsigned_number(const TCHAR * str, uint32_t & number)
+{
+    if (!*str) {
+        return false;
+    }
+
+    uint64_t value = 0;
+
+    for (; *str; str++) {
+        if (*str < _T('0') || *str > _T('9')) {
+            return false;
+        }
+
+        value = (std::min)(value * 10 + uint64_t(*str - _T('0')), uint64_t(math::uint32_max));
+    }
+
+    number = uint32_t(value);
+
+    return true;
+}
+
 // return:
 //  -1 - argument is not detected (not known)
 //   0 - argument is detected and is not in inclusion filter
@@ -125,6 +271,10 @@ int parse_arg_to_option(
                     options.impl_token = Impl::impl_max_weighted_autocorr_of_corr_values;
                     return 1;
                 }
+                else if (is_arg_equal_to(arg, _T("ensemble-of-corr-mean"))) {
+                    options.impl_token = Impl::impl_ensemble_of_corr_mean;
+                    return 1;
+                }
                 else {
                     error = invalid_format_flag(start_arg);
                     return 2;
@@ -165,6 +315,16 @@ int parse_arg_to_option(
         }
         return 0;
     }
+    if (is_arg_equal_to(arg, _T("/impl-eocm"))) {
+        if (is_arg_in_filter(start_arg, include_filter_arr)) {
+            if (options.impl_token != Impl::impl_unknown) {
+                return invalid_format_flag_message(_T("`/impl-token` option is mixed with `/impl-opt*`\n"));
+            }
+            options.impl_token = Impl::impl_ensemble_of_corr_mean;
+            return 1;
+        }
+        return 0;
+    }
     if (is_arg_equal_to(arg, _T("/corr-multiply-method")) || is_arg_equal_to(arg, _T("/corr-mm"))) {
         arg_offset += 1;
         if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
@@ -211,11 +371,75 @@ int parse_arg_to_option(
         }
         return 0;
     }
+    if (is_arg_equal_to(arg, _T("/simd-token"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                if (options.simd_token != Impl::simd_unknown) {
+                    return invalid_format_flag_message(_T("`/simd-token` option is mixed with another `/simd-token`\n"));
+                }
+
+                if (is_arg_equal_to(arg, _T("scalar"))) {
+                    options.simd_token = Impl::simd_scalar;
+                    return 1;
+                }
+                else if (is_arg_equal_to(arg, _T("sse42"))) {
+                    options.simd_token = Impl::simd_sse42;
+                    return 1;
+                }
+                else if (is_arg_equal_to(arg, _T("avx2"))) {
+                    options.simd_token = Impl::simd_avx2;
+                    return 1;
+                }
+                else if (is_arg_equal_to(arg, _T("avx512"))) {
+                    options.simd_token = Impl::simd_avx512;
+                    return 1;
+                }
+                else {
+                    error = invalid_format_flag(start_arg);
+                    return 2;
+                }
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
+    if (is_arg_equal_to(arg, _T("/corr-value-token"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                if (options.corr_value_token != Impl::corr_value_unknown) {
+                    return invalid_format_flag_message(_T("`/corr-value-token` option is mixed with another `/corr-value-token`\n"));
+                }
+
+                if (is_arg_equal_to(arg, _T("float32"))) {
+                    options.corr_value_token = Impl::corr_value_float32;
+                    return 1;
+                }
+                else if (is_arg_equal_to(arg, _T("fixed16"))) {
+                    options.corr_value_token = Impl::corr_value_fixed16;
+                    return 1;
+                }
+                else if (is_arg_equal_to(arg, _T("fixed8"))) {
+                    options.corr_value_token = Impl::corr_value_fixed8;
+                    return 1;
+                }
+                else {
+                    error = invalid_format_flag(start_arg);
+                    return 2;
+                }
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
     if (is_arg_equal_to(arg, _T("/stream-byte-size")) || is_arg_equal_to(arg, _T("/s"))) {
         arg_offset += 1;
         if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
             if (is_arg_in_filter(start_arg, include_filter_arr)) {
-                options.stream_byte_size = _ttoi(arg);
+                options.stream_byte_size = _ttoi64(arg);
                 return 1;
             }
             return 0;
@@ -235,6 +459,18 @@ int parse_arg_to_option(
         else error = invalid_format_flag(start_arg);
         return 2;
     }
+    if (is_arg_equal_to(arg, _T("/stream-chunk-byte-size")) || is_arg_equal_to(arg, _T("/sc"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                options.stream_chunk_byte_size = _ttoi(arg);
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
     if (is_arg_equal_to(arg, _T("/stream-min-period")) || is_arg_equal_to(arg, _T("/spmin"))) {
         arg_offset += 1;
         if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
@@ -287,7 +523,10 @@ int parse_arg_to_option(
         arg_offset += 1;
         if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
             if (is_arg_in_filter(start_arg, include_filter_arr)) {
-                options.syncseq_bit_size = _ttoi(arg);
+                parse_number_list(arg, options.syncseq_bit_size_arr, [](const TCHAR * str) -> uint32_t {
+                    return uint32_t(_ttoi(str));
+                });
+                options.syncseq_bit_size = options.syncseq_bit_size_arr.front();
                 return 1;
             }
             return 0;
@@ -299,7 +538,10 @@ int parse_arg_to_option(
         arg_offset += 1;
         if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
             if (is_arg_in_filter(start_arg, include_filter_arr)) {
-                options.syncseq_int32 = utility::str_to_number<decltype(options.syncseq_int32)>(arg);
+                parse_number_list(arg, options.syncseq_int32_arr, [](const TCHAR * str) -> uint32_t {
+                    return utility::str_to_number<uint32_t>(str);
+                });
+                options.syncseq_int32 = options.syncseq_int32_arr.front();
                 return 1;
             }
             return 0;
@@ -442,6 +684,42 @@ int parse_arg_to_option(
         else error = invalid_format_flag(start_arg);
         return 2;
     }
+    if (is_arg_equal_to(arg, _T("/track-drift-bit-size"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                options.track_drift_bit_size = _ttoi(arg);
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
+    if (is_arg_equal_to(arg, _T("/track-max-misses"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                options.track_max_misses = _ttoi(arg);
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
+    if (is_arg_equal_to(arg, _T("/track-corr-min"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                options.track_corr_min = utility::str_to_float(std::tstring{ arg });
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
     if (is_arg_equal_to(arg, _T("/no-zero-corr"))) {
         if (is_arg_in_filter(start_arg, include_filter_arr)) {
             flags.no_zero_corr = true;
@@ -466,6 +744,14 @@ int parse_arg_to_option(
         }
         return 0;
     }
+    if (is_arg_equal_to(arg, _T("/use-comb-corr-sum"))) {
+        if (is_arg_in_filter(start_arg, include_filter_arr)) {
+            flags.use_comb_corr_sum = true;
+            mod_flags.push_back(arg);
+            return 1;
+        }
+        return 0;
+    }
     if (is_arg_equal_to(arg, _T("/skip-max-weighted-sum-of-corr-mean-calc")) || is_arg_equal_to(arg, _T("/skip-mwsocm-calc")) || is_arg_equal_to(arg, _T("/use-max-corr-mean"))) {
         if (is_arg_in_filter(start_arg, include_filter_arr)) {
             flags.skip_max_weighted_sum_of_corr_mean_calc = true;
@@ -502,6 +788,47 @@ int parse_arg_to_option(
         else error = invalid_format_flag(start_arg);
         return 2;
     }
+    if (is_arg_equal_to(arg, _T("/threads"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                uint32_t num_threads;
+                if (!parse_unsigned_number(arg, num_threads)) {
+                    error = invalid_format_flag(start_arg);
+                    return 2;
+                }
+                options.num_threads = (std::min)(num_threads, uint32_t(MAX_NUM_THREADS));
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
+    if (is_arg_equal_to(arg, _T("/autocorr-fft-min-size"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                options.autocorr_fft_min_size = _ttoi(arg);
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
+    if (is_arg_equal_to(arg, _T("/remap-sync-variants"))) {
+        arg_offset += 1;
+        if (argc >= arg_offset + 1 && (arg = argv[arg_offset])) {
+            if (is_arg_in_filter(start_arg, include_filter_arr)) {
+                options.remap_sync_variants = _ttoi(arg);
+                return 1;
+            }
+            return 0;
+        }
+        else error = invalid_format_flag(start_arg);
+        return 2;
+    }
 
     return -1;
 }
@@ -676,6 +1003,24 @@ int _tmain(int argc, const TCHAR * argv[])
                 else if (g_options.mode == _T("pipe")) {
                     mode = Mode_Pipe;
                 }
+                else if (g_options.mode == _T("sync-stream")) {
+                    mode = Mode_Sync_Stream;
+                }
+                else if (g_options.mode == _T("sync-track")) {
+                    mode = Mode_Sync_Track;
+                }
+                else if (g_options.mode == _T("sync-window")) {
+                    mode = Mode_Sync_Window;
+                }
+                else if (g_options.mode == _T("sync-batch")) {
+                    mode = Mode_Sync_Batch;
+                }
+                else if (g_options.mode == _T("gen-sync")) {
+                    mode = Mode_Gen_Sync;
+                }
+                else if (g_options.mode == _T("sync-remap")) {
+                    mode = Mode_Sync_Remap;
+                }
 
                 if (mode == Mode_None) {
                     _ftprintf(stderr, _T("error: mode is not known: mode=%s\n"), g_options.mode.c_str());
@@ -684,6 +1029,10 @@ int _tmain(int argc, const TCHAR * argv[])
 
                 switch (mode) {
                 case Mode_Sync:
+                case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
+                case Mode_Sync_Window:
+                case Mode_Sync_Batch:
                 {
                     if (g_options.impl_token == Impl::impl_unknown) {
                         _ftprintf(stderr, _T("error: the implementation (`/impl-*` options) must be selected explicitly for the mode: mode=%s\n"), g_options.mode.c_str());
@@ -695,6 +1044,7 @@ int _tmain(int argc, const TCHAR * argv[])
                 switch (mode) {
                 case Mode_Gen:
                 case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
                 {
                     if (argc >= arg_offset + 1 && (arg = argv[arg_offset]) && tstrlen(arg)) {
                         g_options.bits_per_baud = _ttoi(arg);
@@ -718,7 +1068,6 @@ int _tmain(int argc, const TCHAR * argv[])
                 switch (mode) {
                 case Mode_Gen:
                 case Mode_Sync:
-                case Mode_Gen_Sync:
                 {
                     if (argc >= arg_offset + 1 && (arg = argv[arg_offset]) && tstrlen(arg)) {
                         g_options.output_file_dir = arg;
@@ -735,6 +1084,20 @@ int _tmain(int argc, const TCHAR * argv[])
 
                     arg_offset += 1;
                 } break;
+
+                case Mode_Sync_Batch:
+                {
+                    // the rest arguments are input files or wildcard patterns of input files too
+                    if (!g_options.input_file.empty()) {
+                        g_options.input_file_arr.push_back(g_options.input_file);
+                    }
+
+                    for (; argc >= arg_offset + 1 && (arg = argv[arg_offset]); arg_offset++) {
+                        if (tstrlen(arg)) {
+                            g_options.input_file_arr.push_back(tackle::path_tstring{ arg });
+                        }
+                    }
+                } break;
                 }
 
                 if (g_options.stream_byte_size && g_options.stream_bit_size) {
@@ -743,13 +1106,27 @@ int _tmain(int argc, const TCHAR * argv[])
                 }
 
                 switch (mode) {
-                case Mode_Gen:
                 case Mode_Sync:
+                case Mode_Sync_Batch:
+                {
+                    // the whole stream must be addressable by a single buffer with the padding
+                    if (g_options.stream_byte_size >= math::size_max / 8 || g_options.stream_bit_size >= math::size_max) {
+                        _ftprintf(stderr, _T("error: stream_byte_size or stream_bit_size is too big: stream_byte_size=%") _T(PRIu64) _T(" stream_bit_size=%") _T(PRIu64) _T("\n"),
+                            g_options.stream_byte_size, g_options.stream_bit_size);
+                        return 255;
+                    }
+                } break;
+
+                case Mode_Gen:
                 case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                case Mode_Sync_Window:
                 {
                     // safety check by 2GB maximum
                     if (g_options.stream_byte_size >= math::uint32_max / 2) {
-                        _ftprintf(stderr, _T("error: stream_byte_size is too big: stream_byte_size=%u\n"),
+                        _ftprintf(stderr, _T("error: stream_byte_size is too big: stream_byte_size=%") _T(PRIu64) _T("\n"),
                             g_options.stream_byte_size);
                         return 255;
                     }
@@ -763,9 +1140,32 @@ int _tmain(int argc, const TCHAR * argv[])
                 } break;
                 }
 
+                switch (mode) {
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                {
+                    if (!g_options.stream_chunk_byte_size) {
+                        _ftprintf(stderr, _T("error: stream_chunk_byte_size must be positive\n"));
+                        return 255;
+                    }
+
+                    // safety check by 2GB maximum
+                    if (g_options.stream_chunk_byte_size >= math::uint32_max / 2) {
+                        _ftprintf(stderr, _T("error: stream_chunk_byte_size is too big: stream_chunk_byte_size=%u\n"),
+                            g_options.stream_chunk_byte_size);
+                        return 255;
+                    }
+                } break;
+                }
+
                 switch (mode) {
                 case Mode_Sync:
                 case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                case Mode_Sync_Window:
+                case Mode_Sync_Batch:
                 {
                     if (g_options.stream_min_period != math::uint32_max && !g_options.stream_min_period) {
                         _ftprintf(stderr, _T("error: stream_min_period must be positive\n"));
@@ -783,28 +1183,54 @@ int _tmain(int argc, const TCHAR * argv[])
                         return 255;
                     }
 
-                    if (!g_options.syncseq_bit_size) {
-                        _ftprintf(stderr, _T("error: syncseq_bit_size must be positive\n"));
-                        return 255;
+                    if (g_options.syncseq_int32_arr.empty()) {
+                        g_options.syncseq_int32_arr.push_back(g_options.syncseq_int32);
                     }
 
-                    if (32 < g_options.syncseq_bit_size) {
-                        _ftprintf(stderr, _T("error: syncseq_bit_size must be less or equal to 32 bits\n"));
-                        return 255;
+                    if (g_options.syncseq_bit_size_arr.empty()) {
+                        g_options.syncseq_bit_size_arr.push_back(g_options.syncseq_bit_size);
+                    }
+
+                    // a single bit length is used for all synchro sequences
+                    if (g_options.syncseq_bit_size_arr.size() == 1) {
+                        g_options.syncseq_bit_size_arr.resize(g_options.syncseq_int32_arr.size(), g_options.syncseq_bit_size);
                     }
 
-                    if (g_options.stream_min_period != math::uint32_max && g_options.syncseq_bit_size >= g_options.stream_min_period) {
-                        _ftprintf(stderr, _T("error: stream_min_period must be greater than syncseq_bit_size: syncseq_bit_size=%u stream_min_period=%u\n"),
-                            g_options.syncseq_bit_size, g_options.stream_min_period);
+                    if (g_options.syncseq_bit_size_arr.size() != g_options.syncseq_int32_arr.size()) {
+                        _ftprintf(stderr, _T("error: syncseq_bit_size must be a single value or a value per syncseq_int32: syncseq_bit_size=%u syncseq_int32=%u\n"),
+                            uint32_t(g_options.syncseq_bit_size_arr.size()), uint32_t(g_options.syncseq_int32_arr.size()));
                         return 255;
                     }
 
-                    if (g_options.stream_max_period != math::uint32_max && g_options.syncseq_bit_size >= g_options.stream_max_period) {
-                        _ftprintf(stderr, _T("error: stream_max_period must be greater than syncseq_bit_size: syncseq_bit_size=%u stream_max_period=%u\n"),
-                            g_options.syncseq_bit_size, g_options.stream_max_period);
+                    if (mode != Mode_Sync && g_options.syncseq_int32_arr.size() > 1) {
+                        _ftprintf(stderr, _T("error: multiple syncseq_int32 values are supported only in the sync mode\n"));
                         return 255;
                     }
 
+                    for (const auto syncseq_bit_size : g_options.syncseq_bit_size_arr) {
+                        if (!syncseq_bit_size) {
+                            _ftprintf(stderr, _T("error: syncseq_bit_size must be positive\n"));
+                            return 255;
+                        }
+
+                        if (32 < syncseq_bit_size) {
+                            _ftprintf(stderr, _T("error: syncseq_bit_size must be less or equal to 32 bits\n"));
+                            return 255;
+                        }
+
+                        if (g_options.stream_min_period != math::uint32_max && syncseq_bit_size >= g_options.stream_min_period) {
+                            _ftprintf(stderr, _T("error: stream_min_period must be greater than syncseq_bit_size: syncseq_bit_size=%u stream_min_period=%u\n"),
+                                syncseq_bit_size, g_options.stream_min_period);
+                            return 255;
+                        }
+
+                        if (g_options.stream_max_period != math::uint32_max && syncseq_bit_size >= g_options.stream_max_period) {
+                            _ftprintf(stderr, _T("error: stream_max_period must be greater than syncseq_bit_size: syncseq_bit_size=%u stream_max_period=%u\n"),
+                                syncseq_bit_size, g_options.stream_max_period);
+                            return 255;
+                        }
+                    }
+
                     //if (!g_options.syncseq_int32) {
                     //    _ftprintf(stderr, _T("error: syncseq_bytes must not 0\n"));
                     //    return 255;
@@ -854,19 +1280,87 @@ int _tmain(int argc, const TCHAR * argv[])
                     return 255;
                 }
 
-                if (!g_options.corr_mean_buf_max_size_mb) {
-                    _ftprintf(stderr, _T("error: corr_mean_buf_max_size_mb must be positive.\n"));
-                    return 255;
-                }
-
-                if (g_options.input_file.empty() || !utility::is_regular_file(g_options.input_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, false)) {
-                    _ftprintf(stderr, _T("error: input file is not found: \"%s\"\n"), g_options.input_file.c_str());
+                if (g_options.track_corr_min != math::float_max && (g_options.track_corr_min < 0 || g_options.track_corr_min > 1.0)) {
+                    _ftprintf(stderr, _T("error: track_corr_min must be in range [0; 1]: track_corr_min=%f\n"), g_options.track_corr_min);
                     return 255;
                 }
 
-                tackle::file_handle<TCHAR> tee_file_in_handle;
-
-                if (!g_options.tee_input_file.empty()) {
+                switch (mode) {
+                case Mode_Sync_Track:
+                {
+                    if (!g_options.track_max_misses) {
+                        _ftprintf(stderr, _T("error: track_max_misses must be positive\n"));
+                        return 255;
+                    }
+                } break;
+
+                case Mode_Sync_Window:
+                {
+                    // the windows overlap is calculated from the maximum period
+                    if (g_options.stream_max_period == math::uint32_max) {
+                        _ftprintf(stderr, _T("error: stream_max_period must be defined to define the windows overlap\n"));
+                        return 255;
+                    }
+
+                    // the windows are read in parallel and overlapped, so the preprocessed input can not be written sequentially
+                    if (!g_options.tee_input_file.empty()) {
+                        _ftprintf(stderr, _T("error: tee input file is not supported by the mode: mode=%s\n"), g_options.mode.c_str());
+                        return 255;
+                    }
+                } break;
+
+                case Mode_Sync_Batch:
+                {
+                    // the input files are read in parallel, so the preprocessed input can not be written sequentially
+                    if (!g_options.tee_input_file.empty()) {
+                        _ftprintf(stderr, _T("error: tee input file is not supported by the mode: mode=%s\n"), g_options.mode.c_str());
+                        return 255;
+                    }
+                } break;
+                }
+
+                if (!g_options.corr_mean_buf_max_size_mb) {
+                    _ftprintf(stderr, _T("error: corr_mean_buf_max_size_mb must be positive.\n"));
+                    return 255;
+                }
+
+                // the sync stream modes does read the standard input by `-` or a not regular file like a FIFO
+                const bool is_stream_mode = mode == Mode_Sync_Stream || mode == Mode_Sync_Track;
+                const bool is_stdin_input = is_stream_mode && g_options.input_file == _T("-");
+
+                switch (mode) {
+                case Mode_Sync_Batch:
+                {
+                    if (g_options.input_file_arr.empty()) {
+                        _ftprintf(stderr, _T("error: input file is not defined\n"));
+                        return 255;
+                    }
+
+                    std::vector<tackle::path_tstring> input_file_arr;
+
+                    for (const auto & input_file_pattern : g_options.input_file_arr) {
+                        if (!expand_input_file_pattern(input_file_pattern, input_file_arr)) {
+                            _ftprintf(stderr, _T("error: input file is not found: \"%s\"\n"), input_file_pattern.c_str());
+                            return 255;
+                        }
+                    }
+
+                    g_options.input_file_arr = std::move(input_file_arr);
+                } break;
+
+                default:
+                {
+                    if (g_options.input_file.empty() || !is_stdin_input && !utility::is_regular_file(g_options.input_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, false) &&
+                        (!is_stream_mode || !boost::fs::exists(boost::fs::path{ g_options.input_file.str() }))) {
+                        _ftprintf(stderr, _T("error: input file is not found: \"%s\"\n"), g_options.input_file.c_str());
+                        return 255;
+                    }
+                }
+                }
+
+                tackle::file_handle<TCHAR> tee_file_in_handle;
+
+                if (!g_options.tee_input_file.empty()) {
                     tee_file_in_handle = utility::open_file(g_options.tee_input_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, _T("wb"), utility::SharedAccess_DenyWrite, 0, 0);
                     if (!tee_file_in_handle.get()) {
                         _ftprintf(stderr, _T("error: could not open output tee file for the input: \"%s\"\n"), g_options.tee_input_file.c_str());
@@ -877,7 +1371,6 @@ int _tmain(int argc, const TCHAR * argv[])
                 switch (mode) {
                 case Mode_Gen:
                 case Mode_Sync:
-                case Mode_Gen_Sync:
                 {
                     if (g_options.output_file_dir.empty()) {
                         g_options.output_file_dir = utility::get_current_path(false, tackle::tag_native_path_tstring{});
@@ -904,23 +1397,129 @@ int _tmain(int argc, const TCHAR * argv[])
                 } break;
                 }
 
-                const tackle::file_handle<TCHAR> file_in_handle =
-                    utility::open_file(g_options.input_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, _T("rb"), utility::SharedAccess_DenyWrite);
+                // the batch mode does open each input file separately
+                const tackle::file_handle<TCHAR> file_in_handle = !is_stdin_input && mode != Mode_Sync_Batch ?
+                    utility::open_file(g_options.input_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, _T("rb"), utility::SharedAccess_DenyWrite) :
+                    tackle::file_handle<TCHAR>{};
 
                 if (g_options.stream_bit_size) {
-                    g_options.stream_byte_size = uint32_t((g_options.stream_bit_size + 7) / 8);
+                    g_options.stream_byte_size = (g_options.stream_bit_size + 7) / 8;
                 }
 
-                const uint64_t stream_byte_size = uint32_t((std::min)(utility::get_file_size(file_in_handle), uint64_t(math::uint32_max))); // CAUTION: read only first 4GB
-                if (!g_options.stream_byte_size || stream_byte_size < g_options.stream_byte_size) {
-                    g_options.stream_byte_size = uint32_t(stream_byte_size);
-                    g_options.stream_bit_size = uint32_t(g_options.stream_byte_size) * 8;
+                switch (mode) {
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                {
+                    // The input is not bounded, so the stream size is the sliding window size. If not defined, then the window is enough to fit the
+                    // maximum repeats of the maximum period.
+                    //
+                    if (!g_options.stream_bit_size) {
+                        if (g_options.stream_byte_size) {
+                            g_options.stream_bit_size = uint64_t(g_options.stream_byte_size) * 8;
+                        }
+                        else if (g_options.stream_max_period != math::uint32_max) {
+                            const uint32_t syncseq_max_repeat = g_options.syncseq_max_repeat != math::uint32_max ?
+                                g_options.syncseq_max_repeat :
+                                (g_options.syncseq_min_repeat != math::uint32_max && g_options.syncseq_min_repeat > DEFAULT_SYNCSEQ_MAXIMAL_REPEAT_PERIOD ?
+                                    g_options.syncseq_min_repeat : DEFAULT_SYNCSEQ_MAXIMAL_REPEAT_PERIOD);
+
+                            g_options.stream_bit_size = uint64_t(g_options.stream_max_period) * (uint64_t(syncseq_max_repeat) + 1);
+                        }
+                        else {
+                            _ftprintf(stderr, _T("error: stream_byte_size or stream_bit_size or stream_max_period must be defined to define the window size\n"));
+                            return 255;
+                        }
+
+                        // safety check by 2GB maximum
+                        if (g_options.stream_bit_size >= uint64_t(math::uint32_max) * 8 / 2) {
+                            _ftprintf(stderr, _T("error: stream_bit_size is too big: stream_bit_size=%") _T(PRIu64) _T("\n"),
+                                g_options.stream_bit_size);
+                            return 255;
+                        }
+
+                        g_options.stream_byte_size = (g_options.stream_bit_size + 7) / 8;
+                    }
+                } break;
+
+                case Mode_Sync_Window:
+                {
+                    // The stream size is the window size. If not defined, then the window is the double of the overlap, where the overlap is enough to
+                    // fit the maximum repeats of the maximum period.
+                    //
+                    if (!g_options.stream_bit_size) {
+                        if (g_options.stream_byte_size) {
+                            g_options.stream_bit_size = uint64_t(g_options.stream_byte_size) * 8;
+                        }
+                        else {
+                            const uint32_t syncseq_max_repeat = g_options.syncseq_max_repeat != math::uint32_max ?
+                                g_options.syncseq_max_repeat :
+                                (g_options.syncseq_min_repeat != math::uint32_max && g_options.syncseq_min_repeat > DEFAULT_SYNCSEQ_MAXIMAL_REPEAT_PERIOD ?
+                                    g_options.syncseq_min_repeat : DEFAULT_SYNCSEQ_MAXIMAL_REPEAT_PERIOD);
+
+                            g_options.stream_bit_size = uint64_t(g_options.stream_max_period) * syncseq_max_repeat * 2;
+                        }
+
+                        // safety check by 2GB maximum
+                        if (g_options.stream_bit_size >= uint64_t(math::uint32_max) * 8 / 2) {
+                            _ftprintf(stderr, _T("error: stream_bit_size is too big: stream_bit_size=%") _T(PRIu64) _T("\n"),
+                                g_options.stream_bit_size);
+                            return 255;
+                        }
+
+                        g_options.stream_byte_size = (g_options.stream_bit_size + 7) / 8;
+                    }
+
+                    // the window is not greater than the input
+                    const uint64_t stream_byte_size = utility::get_file_size(file_in_handle);
+                    if (stream_byte_size < g_options.stream_byte_size) {
+                        g_options.stream_byte_size = stream_byte_size;
+                        g_options.stream_bit_size = g_options.stream_byte_size * 8;
+                    }
+                } break;
+
+                case Mode_Sync:
+                {
+                    // NOTE:
+                    //  The sync mode does read the whole stream, so it is not limited by 4GB. The offsets of the results are 64-bit and the results are
+                    //  stored in the compact 32-bit layout if the stream is less than 2^32 bits.
+                    //
+                    const uint64_t stream_byte_size = utility::get_file_size(file_in_handle);
+                    if (!g_options.stream_byte_size || stream_byte_size < g_options.stream_byte_size) {
+                        g_options.stream_byte_size = stream_byte_size;
+                        g_options.stream_bit_size = g_options.stream_byte_size * 8;
+                    }
+
+                    if (g_options.stream_byte_size >= math::size_max / 8) {
+                        _ftprintf(stderr, _T("error: stream_byte_size is too big: stream_byte_size=%") _T(PRIu64) _T("\n"),
+                            g_options.stream_byte_size);
+                        return 255;
+                    }
+                } break;
+
+                case Mode_Sync_Batch:
+                {
+                    // the stream size is the size of each input file but not greater than `/stream-byte-size` if defined
+                } break;
+
+                default:
+                {
+                    const uint64_t stream_byte_size = uint32_t((std::min)(utility::get_file_size(file_in_handle), uint64_t(math::uint32_max))); // CAUTION: read only first 4GB
+                    if (!g_options.stream_byte_size || stream_byte_size < g_options.stream_byte_size) {
+                        g_options.stream_byte_size = stream_byte_size;
+                        g_options.stream_bit_size = g_options.stream_byte_size * 8;
+                    }
+                }
                 }
 
                 switch (mode) {
                 case Mode_Gen:
                 case Mode_Sync:
                 case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                case Mode_Sync_Window:
+                case Mode_Sync_Batch:
                 {
                     if (g_options.stream_bit_size && g_options.stream_bit_size <= 32) {
                         _ftprintf(stderr, _T("error: stream_bit_size must be greater than 32 bits\n"));
@@ -932,6 +1531,10 @@ int _tmain(int argc, const TCHAR * argv[])
                 switch (mode) {
                 case Mode_Sync:
                 case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                case Mode_Sync_Window:
                 {
                     // /spmin vs /si
                     if (g_options.stream_min_period != math::uint32_max && g_options.stream_min_period >= g_options.stream_bit_size) {
@@ -961,6 +1564,32 @@ int _tmain(int argc, const TCHAR * argv[])
                 g_options.update_corr_mm_defaults();
                 g_options.update_corr_min_defaults(g_flags);
 
+                // explicitly selected instruction set must be supported and must pass the self test
+                if (g_options.simd_token != Impl::simd_unknown) {
+                    if (!is_corr_simd_supported(g_options.simd_token)) {
+                        _ftprintf(stderr, _T("error: simd_token is not supported by the processor or the build: simd_token=%i\n"),
+                            g_options.simd_token);
+                        return 255;
+                    }
+
+                    if (!corr_simd_self_test(g_options.simd_token)) {
+                        _ftprintf(stderr, _T("error: simd_token self test is failed: simd_token=%i\n"),
+                            g_options.simd_token);
+                        return 255;
+                    }
+                }
+
+                // the autocorrelation values calculation through the FFT must pass the self test
+                if (g_options.impl_token == Impl::impl_max_weighted_autocorr_of_corr_values) {
+                    if (!corr_autocorr_fft_self_test()) {
+                        _ftprintf(stderr, _T("error: autocorrelation FFT self test is failed\n"));
+                        return 255;
+                    }
+                }
+
+                g_options.update_simd_token_defaults();
+                g_options.update_corr_value_token_defaults();
+
                 //if (!g_options.is_corr_mm_default()) {
                 //    mod_flags.push_back(std::tstring{ _T("/corr-mm-") } + g_options.corr_mm_token_str);
                 //}
@@ -1035,6 +1664,7 @@ int _tmain(int argc, const TCHAR * argv[])
                 case Mode_Gen:
                 case Mode_Sync:
                 case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
                 {
                     // CAUTION: factorial => (2^3)! = 8! = 40320 ( (2^4)! = 16! = 20922789888000 - greater than 32 bits! )
                     for (uint32_t i = 1; i <= baud_capacity; i++) {
@@ -1134,20 +1764,18 @@ int _tmain(int argc, const TCHAR * argv[])
                 {
                     // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
                     //
-                    const uint32_t padded_stream_byte_size = g_options.stream_byte_size + 3;
+                    const uint32_t padded_stream_byte_size = uint32_t(g_options.stream_byte_size + 3);
 
-                    GenData gen_data{
+                    GenVariantsData gen_variants_data{
                         BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
-                        &baud_alphabet_start_sequence,
-                        nullptr,
-                        baud_mask,
-                        baud_capacity,
-                        0,
                         StreamParams{ padded_stream_byte_size, 0, 0 },
-                        NoiseParams{}
+                        NoiseParams{},
+                        {},
+                        nullptr
                     };
 
-                    ReadFileChunkData read_file_chunk_data{ mode, &gen_data };
+                    std::vector<tackle::path_tstring> out_file_arr;
+                    std::vector<uint32_t> combination_variant_arr;
 
                     // CAUTION:
                     //  We must additionally shift file on `bits_per_baud - 1` times!
@@ -1166,29 +1794,51 @@ int _tmain(int argc, const TCHAR * argv[])
                                 utility::int_to_dec(j, 1, utility::tag_tstring{}) + _T("-") + utility::int_to_dec(i, 2, utility::tag_tstring{}) +
                                 boost::fs::path{ g_options.input_file.str() }.extension().tstring() };
 
-                            gen_data.baud_alphabet_end_sequence = &baud_alphabet_sequences[i];
-                            gen_data.stream_params.last_bit_offset = 0;
-                            gen_data.shifted_bit_offset = j;
+                            gen_variants_data.variant_data_arr.push_back(GenData{
+                                gen_variants_data.basic_data,
+                                &baud_alphabet_start_sequence,
+                                &baud_alphabet_sequences[i],
+                                baud_mask,
+                                baud_capacity,
+                                j,
+                                StreamParams{ padded_stream_byte_size, 0, 0 },
+                                NoiseParams{},
+                                utility::recreate_file(out_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, _T("wb"), utility::SharedAccess_DenyWrite),
+                                {}
+                            });
+
+                            out_file_arr.push_back(out_file);
+                            combination_variant_arr.push_back(i);
+                        }
+                    }
 
-                            gen_data.file_out_handle = utility::recreate_file(out_file, IF_UNICODE(std::codecvt_utf8, std::codecvt_utf16)<wchar_t>{}, _T("wb"), utility::SharedAccess_DenyWrite);
+                    // the variants of a chunk are translated and written in parallel
+                    gen_variants_data.pool_ptr.reset(new WorkStealingPool{ g_options.num_threads });
 
-                            fseek(file_in_handle.get(), 0, SEEK_SET);
-                            tackle::file_reader<TCHAR>(file_in_handle, read_file_chunk).do_read(&read_file_chunk_data, { g_options.stream_byte_size }, padded_stream_byte_size);
+                    ReadFileChunkData read_file_chunk_data{ mode, &gen_variants_data };
 
-                            fmt::print(
-                                _T("#{:d}-{:d}: `{:s}`:\n"), j, i, out_file.c_str());
+                    // the input is read once for all the variants
+                    if (!gen_variants_data.variant_data_arr.empty()) {
+                        fseek(file_in_handle.get(), 0, SEEK_SET); // just in case
+                        tackle::file_reader<TCHAR>(file_in_handle, read_file_chunk).do_read(&read_file_chunk_data, { g_options.stream_byte_size }, padded_stream_byte_size);
+                    }
 
-                            for (uint32_t k = 0; k < baud_capacity; k++) {
-                                const uint32_t from_baud = baud_alphabet_start_sequence[k];
-                                const uint32_t to_baud = (*gen_data.baud_alphabet_end_sequence)[k];
-                                if (from_baud != to_baud) {
-                                    fmt::print(
-                                        _T("  {0:#0{2}b} -> {1:#0{2}b}\n"), from_baud, to_baud, 2 + g_options.bits_per_baud);
-                                }
-                            }
+                    for (size_t n = 0; n < gen_variants_data.variant_data_arr.size(); n++) {
+                        const GenData & gen_data = gen_variants_data.variant_data_arr[n];
+
+                        fmt::print(
+                            _T("#{:d}-{:d}: `{:s}`:\n"), gen_data.shifted_bit_offset, combination_variant_arr[n], out_file_arr[n].c_str());
 
-                            ret = 0;
+                        for (uint32_t k = 0; k < baud_capacity; k++) {
+                            const uint32_t from_baud = baud_alphabet_start_sequence[k];
+                            const uint32_t to_baud = (*gen_data.baud_alphabet_end_sequence)[k];
+                            if (from_baud != to_baud) {
+                                fmt::print(
+                                    _T("  {0:#0{2}b} -> {1:#0{2}b}\n"), from_baud, to_baud, 2 + g_options.bits_per_baud);
+                            }
                         }
+
+                        ret = 0;
                     }
                 } break;
 
@@ -1197,16 +1847,18 @@ int _tmain(int argc, const TCHAR * argv[])
                     // Buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
                     // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
                     //
-                    const uint32_t padded_stream_byte_size = ((g_options.stream_byte_size + 3) & ~uint32_t(3)) + 4;
+                    const uint64_t padded_stream_byte_size = ((g_options.stream_byte_size + 3) & ~uint64_t(3)) + 4;
 
                     SyncData sync_data{
                         BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
-                        math::uint32_max,
+                        math::uint64_max,
                         StreamParams{ padded_stream_byte_size, 0, 0 },
                         NoiseParams{},
                         CorrInParams{
                             g_options.impl_token,
                             g_options.corr_mm,
+                            g_options.simd_token,
+                            g_options.corr_value_token,
                             uint64_t(g_options.stream_byte_size) * 8,
                             g_options.syncseq_bit_size,
                             g_options.corr_min,
@@ -1218,9 +1870,12 @@ int _tmain(int argc, const TCHAR * argv[])
                             g_options.max_periods_in_offset,
                             g_options.max_corr_values_per_period,
                             size_t(g_options.corr_mean_buf_max_size_mb * 1024 * 1024), // 4GB max
+                            g_options.num_threads,
+                            g_options.autocorr_fft_min_size,
                             g_flags.no_zero_corr,
                             g_flags.use_linear_corr,
                             g_flags.skip_calc_on_filtered_corr_value_use,
+                            g_flags.use_comb_corr_sum,
                             g_flags.skip_max_weighted_sum_of_corr_mean_calc,
                             g_flags.sort_at_first_by_max_corr_mean,
                             g_flags.return_sorted_result
@@ -1228,7 +1883,11 @@ int _tmain(int argc, const TCHAR * argv[])
                         CorrInOutParams{
                             g_options.syncseq_int32         // CAUTION: bit length can be greater than `syncseq_bit_size`
                         },
-                        CorrOutParams{}
+                        CorrOutParams{},
+                        math::uint64_max,
+                        math::uint32_max,
+                        false,
+                        {}
                     };
 
                     ReadFileChunkData read_file_chunk_data{ mode, &sync_data };
@@ -1244,6 +1903,9 @@ int _tmain(int argc, const TCHAR * argv[])
                     if (sync_data.corr_out_params.accum_corr_mean_quit) {
                         offset_suffix_msg_str += _T(" [UNCERTAIN]");
                     }
+                    if (sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean && !sync_data.ensemble_agreement) {
+                        offset_suffix_msg_str += _T(" [DISAGREEMENT]");
+                    }
 
                     const std::tstring offset_prefix_warn_str = !offset_suffix_msg_str.empty() ? _T("[!] ") : _T("    ");
 
@@ -1261,9 +1923,27 @@ int _tmain(int argc, const TCHAR * argv[])
                                 sync_data.corr_out_params.max_corr_mean) :
                             _T("");
 
+                    // ensemble parameters
+                    const std::tstring ensemble_params =
+                        sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean ?
+                            fmt::format(
+                                _T(
+                                    "ensemble deviat offset/period: {:s} / {:s}\n"
+                                    "ensemble agreement:            {:s}\n"
+                                ),
+                                sync_data.ensemble_syncseq_bit_offset != math::uint64_max ?
+                                    std::to_tstring(sync_data.ensemble_syncseq_bit_offset) :
+                                    _T("-"),
+                                sync_data.ensemble_stream_width != math::uint32_max ?
+                                    std::to_tstring(sync_data.ensemble_stream_width) :
+                                    _T("-"),
+                                sync_data.ensemble_agreement ? _T("yes") : _T("no")) :
+                            _T("");
+
                     // mean deviation parameters
                     const std::tstring mean_deviat_params =
-                        sync_data.corr_in_params.impl_token == Impl::impl_min_sum_of_corr_mean_deviat ?
+                        sync_data.corr_in_params.impl_token == Impl::impl_min_sum_of_corr_mean_deviat ||
+                        sync_data.corr_in_params.impl_token == Impl::impl_ensemble_of_corr_mean ?
                             fmt::format(
                                 _T("corr mean deviat min/max:      {:#06f} / {:#06f}\n"),
                                 sync_data.corr_out_params.min_corr_mean_deviat,
@@ -1302,13 +1982,47 @@ int _tmain(int argc, const TCHAR * argv[])
                             calc_time_phase.calc_time_dur_sec);
                     }
 
+                    // the results of each synchro sequence in case of multiple synchro sequences
+                    for (size_t i = 0; i < sync_data.pattern_result_arr.size(); i++) {
+                        const SyncPatternResult & pattern_result = sync_data.pattern_result_arr[i];
+
+                        const bool is_found = pattern_result.syncseq_bit_offset != math::uint64_max && pattern_result.stream_width != math::uint32_max;
+
+                        std::tstring pattern_suffix_msg_str;
+
+                        if (pattern_result.input_inconsistency) {
+                            pattern_suffix_msg_str += _T(" [INPUT INCONSISTENCY]");
+                        }
+                        if (pattern_result.uncertain) {
+                            pattern_suffix_msg_str += _T(" [UNCERTAIN]");
+                        }
+                        if (pattern_result.disagreement) {
+                            pattern_suffix_msg_str += _T(" [DISAGREEMENT]");
+                        }
+
+                        fmt::print(
+                            _T("syncseq #{:d} {:d} / {:#010x}: offset/period/corr mean: {:s} / {:s} / {:s}{:s}\n"),
+                            i, pattern_result.syncseq_bit_size, pattern_result.syncseq_int32,
+                            is_found ? std::to_tstring(pattern_result.syncseq_bit_offset) : _T("-"),
+                            is_found ? std::to_tstring(pattern_result.stream_width) : _T("-"),
+                            pattern_result.corr_mean != math::float_max ? fmt::format(_T("{:#06f}"), pattern_result.corr_mean) : _T("-"),
+                            pattern_suffix_msg_str);
+                    }
+
+                    if (!sync_data.pattern_result_arr.empty()) {
+                        fmt::print(_T("\n"));
+                    }
+
                     fmt::print(
                         _T(
                             "impl token:                    {:d} / {:s}\n"
                             "corr multiply method:          {:d} / {:s}\n"
+                            "simd token:                    {:d} / {:s}\n"
+                            "corr value token:              {:d} / {:s}\n"
                             "syncseq length/value:          {:d} / {:#010x}\n"
                             "offset:                    {:s}{:s}{:s}\n"                     // CAUTION: can be greater than stream width/period because of noise or synchronous sequence change in the input data!
                             "period (width):                {:s}\n"
+                            "{:s}"                                                          // used when the ensemble implementation is selected
                             "stream bit length:             {:d}\n"
                             "max periods {{in}} offset:       {:d}\n"
                             "period {{in}} min/max:           {:d} / {:s}\n"
@@ -1319,6 +2033,7 @@ int _tmain(int argc, const TCHAR * argv[])
                             "{:s}"                                                          // used when correlation mean values calculation algorithm is enabled
                             "{:s}"                                                          // used when correlation mean deviation values calculation algorithm is enabled
                             "max corr values per period:    {:d}\n"
+                            "threads:                       {:s}\n"
                             "num corr values calc/iter:     {:d} / {:d}\n"
                             "{:s}"                                                          // used when correlation mean values calculation algorithm is enabled
                             "input noise pttn bits/prob:    {:s}\n"
@@ -1328,15 +2043,18 @@ int _tmain(int argc, const TCHAR * argv[])
                         ),
                         sync_data.corr_in_params.impl_token, !g_options.impl_token_str.empty() ? g_options.impl_token_str : std::tstring{ _T("-") },
                         sync_data.corr_in_params.corr_mm, !g_options.corr_mm_token_str.empty() ? g_options.corr_mm_token_str : std::tstring{ _T("-") },
-                        g_options.syncseq_bit_size, sync_data.corr_io_params.syncseq_int32,
+                        sync_data.corr_in_params.simd_token, !g_options.simd_token_str.empty() ? g_options.simd_token_str : std::tstring{ _T("-") },
+                        sync_data.corr_in_params.corr_value_token, !g_options.corr_value_token_str.empty() ? g_options.corr_value_token_str : std::tstring{ _T("-") },
+                        sync_data.corr_in_params.syncseq_bit_size, sync_data.corr_io_params.syncseq_int32,
                         offset_prefix_warn_str,
-                        sync_data.syncseq_bit_offset != math::uint32_max ?
+                        sync_data.syncseq_bit_offset != math::uint64_max ?
                             std::to_tstring(sync_data.syncseq_bit_offset) :
                             _T("-"),
                         offset_suffix_msg_str,
                         sync_data.stream_params.stream_width != math::uint32_max ?
                             std::to_tstring(sync_data.stream_params.stream_width) :
                             _T("-"),
+                        ensemble_params,
                         g_options.stream_byte_size * 8,
                         sync_data.corr_in_params.max_periods_in_offset,
                         sync_data.corr_in_params.min_period,
@@ -1353,6 +2071,9 @@ int _tmain(int argc, const TCHAR * argv[])
                         mean_params,
                         mean_deviat_params,
                         sync_data.corr_in_params.max_corr_values_per_period,
+                        sync_data.corr_in_params.num_threads ?
+                            std::to_tstring(sync_data.corr_in_params.num_threads) :
+                            std::tstring{ _T("all") },
                         sync_data.corr_out_params.num_corr_values_calc,
                         sync_data.corr_out_params.num_corr_values_iterated,
                         mean_mem_params,
@@ -1368,11 +2089,514 @@ int _tmain(int argc, const TCHAR * argv[])
                     ret = 0;
                 } break;
 
+                case Mode_Sync_Stream:
+                case Mode_Sync_Track:
+                {
+                    // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+                    //
+                    const uint32_t padded_stream_chunk_byte_size = g_options.stream_chunk_byte_size + 3;
+
+                    SyncStreamData sync_stream_data{
+                        BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
+                        StreamParams{ padded_stream_chunk_byte_size, 0, 0 },
+                        NoiseParams{},
+                        CorrInParams{
+                            g_options.impl_token,
+                            g_options.corr_mm,
+                            g_options.simd_token,
+                            g_options.corr_value_token,
+                            g_options.stream_bit_size,      // window bit size
+                            g_options.syncseq_bit_size,
+                            g_options.corr_min,
+                            g_options.corr_mean_min,
+                            g_options.stream_min_period,
+                            g_options.stream_max_period,
+                            g_options.syncseq_min_repeat,
+                            g_options.syncseq_max_repeat,
+                            g_options.max_periods_in_offset,
+                            g_options.max_corr_values_per_period,
+                            size_t(g_options.corr_mean_buf_max_size_mb * 1024 * 1024), // 4GB max
+                            g_options.num_threads,
+                            g_options.autocorr_fft_min_size,
+                            g_flags.no_zero_corr,
+                            g_flags.use_linear_corr,
+                            g_flags.skip_calc_on_filtered_corr_value_use,
+                            g_flags.use_comb_corr_sum,
+                            g_flags.skip_max_weighted_sum_of_corr_mean_calc,
+                            g_flags.sort_at_first_by_max_corr_mean,
+                            g_flags.return_sorted_result
+                        },
+                        CorrInOutParams{
+                            g_options.syncseq_int32         // CAUTION: bit length can be greater than `syncseq_bit_size`
+                        },
+                        CorrOutParams{},
+                        StreamTrackParams{
+                            g_options.track_drift_bit_size,
+                            mode == Mode_Sync_Track ? g_options.track_max_misses : 0,
+                            g_options.track_corr_min
+                        },
+                        nullptr,
+                        0
+                    };
+
+                    sync_stream_data.stream_sync_tracker_ptr.reset(
+                        new StreamSyncTracker{
+                            sync_stream_data.corr_in_params, sync_stream_data.track_params, sync_stream_data.corr_io_params, sync_stream_data.corr_out_params
+                        });
+
+                    const StreamSyncTracker & stream_sync_tracker = *sync_stream_data.stream_sync_tracker_ptr;
+
+                    if (sync_stream_data.corr_out_params.input_inconsistency) {
+                        _ftprintf(stderr, _T("error: periods are inconsistent with the window: stream_bit_size=%") _T(PRIu64) _T(" period_min=%u period_max=%u\n"),
+                            g_options.stream_bit_size, sync_stream_data.corr_out_params.min_period, sync_stream_data.corr_out_params.max_period);
+                        return 255;
+                    }
+
+                    if (stream_sync_tracker.buffers_bytes() > sync_stream_data.corr_in_params.max_corr_mean_bytes) {
+                        _ftprintf(stderr, _T("error: corr_mean_buf_max_size_mb is not enough for the window buffers: buffers_bytes=%") _T(PRIu64) _T("\n"),
+                            stream_sync_tracker.buffers_bytes());
+                        return 255;
+                    }
+
+                    // NOTE:
+                    //  The input is read directly instead of the `tackle::file_reader`, because the standard input is not owned by a file handle.
+                    //  A chunk is processed after it is read completely or after the end of the input.
+                    //
+                    FILE * file_in = is_stdin_input ? stdin : file_in_handle.get();
+
+                    if (is_stdin_input) {
+                        _setmode(_fileno(stdin), _O_BINARY);
+                    }
+
+                    std::vector<uint8_t> stream_chunk_buf(padded_stream_chunk_byte_size);
+
+                    for (;;) {
+                        const size_t read_size = fread(stream_chunk_buf.data(), 1, g_options.stream_chunk_byte_size, file_in);
+
+                        if (read_size) {
+                            search_synchro_sequence_stream(sync_stream_data, stream_chunk_buf.data(), uint32_t(read_size));
+                        }
+
+                        if (read_size < g_options.stream_chunk_byte_size) {
+                            const int file_read_err = ferror(file_in);
+                            if (file_read_err) {
+                                throw std::runtime_error(fmt::format("input read error: error={:d}", file_read_err));
+                            }
+                            break;
+                        }
+                    }
+
+                    const StreamSyncLock & lock = stream_sync_tracker.lock();
+
+                    fmt::print(
+                        _T(
+                            "syncseq length/value:          {:d} / {:#010x}\n"
+                            "offset:                        {:s}\n"
+                            "period (width):                {:s}\n"
+                            "confidence:                    {:s}\n"
+                            "lock changes:                  {:d}\n"
+                            "track drift/misses/corr min:   {:s}\n"
+                            "tracking/reacquisitions:       {:s}\n"
+                            "stream bit length:             {:d}\n"
+                            "window bit length:             {:d}\n"
+                            "period {{in}} min/max:           {:d} / {:s}\n"
+                            "period {{io}} min/max:           {:d} / {:d}\n"
+                            "period min repeat:             {:d}\n"
+                            "user corr value/mean min:      {:#06f} / {:#06f}\n"
+                            "corr value min/max:            {:s} / {:#06f}\n"
+                            "window buffers mem:            {:d} Kb\n"
+                            "threads:                       {:s}\n"
+                            "num corr values calc/iter:     {:d} / {:d}\n"
+                            "input noise pttn bits/prob:    {:s}\n"
+                        ),
+                        g_options.syncseq_bit_size, sync_stream_data.corr_io_params.syncseq_int32,
+                        lock.period ? std::to_tstring(lock.offset) : _T("-"),
+                        lock.period ? std::to_tstring(lock.period) : _T("-"),
+                        lock.period ? fmt::format(_T("{:#06f}"), lock.corr_mean) : _T("-"),
+                        sync_stream_data.num_lock_changes,
+                        sync_stream_data.track_params.max_misses ?
+                            fmt::format(_T("{:d} / {:d} / {:#06f}"),
+                                sync_stream_data.track_params.drift_bit_size, sync_stream_data.track_params.max_misses, sync_stream_data.track_params.corr_min) :
+                            _T("-"),
+                        sync_stream_data.track_params.max_misses ?
+                            fmt::format(_T("{:s} / {:d}"),
+                                stream_sync_tracker.is_tracking() ? _T("yes") : _T("no"), stream_sync_tracker.num_reacquisitions()) :
+                            _T("-"),
+                        stream_sync_tracker.stream_bit_size(),
+                        stream_sync_tracker.window_bit_size(),
+                        sync_stream_data.corr_in_params.min_period,
+                        sync_stream_data.corr_in_params.max_period != math::uint32_max ?
+                            std::to_tstring(sync_stream_data.corr_in_params.max_period) :
+                            _T("-"),
+                        sync_stream_data.corr_out_params.min_period, sync_stream_data.corr_out_params.max_period,
+                        sync_stream_data.corr_in_params.period_min_repeat,
+                        sync_stream_data.corr_in_params.corr_min, sync_stream_data.corr_in_params.corr_mean_min,
+                        sync_stream_data.corr_out_params.min_corr_value != math::float_max ?
+                            fmt::format(_T("{:#06f}"), sync_stream_data.corr_out_params.min_corr_value) :
+                            _T("-"),
+                        sync_stream_data.corr_out_params.max_corr_value,
+                        (stream_sync_tracker.buffers_bytes() + 1023) / 1024,
+                        sync_stream_data.corr_in_params.num_threads ?
+                            std::to_tstring(sync_stream_data.corr_in_params.num_threads) :
+                            std::tstring{ _T("all") },
+                        sync_stream_data.corr_out_params.num_corr_values_calc,
+                        sync_stream_data.corr_out_params.num_corr_values_iterated,
+                        g_options.gen_input_noise_bit_block_size ?
+                            fmt::format(_T("{:d} / {:#03d} %"), g_options.gen_input_noise_bit_block_size, g_options.gen_input_noise_block_bit_prob) :
+                            _T("-"));
+
+                    ret = 0;
+                } break;
+
+                case Mode_Sync_Window:
+                {
+                    // the overlap does fit the maximum repeats of the maximum period to find the synchro sequence on a window bound
+                    // CAUTION: the product can exceed 32-bit, so it is checked before the truncation
+                    const uint64_t overlap_byte_size = (uint64_t(g_options.stream_max_period) * g_options.syncseq_max_repeat + 7) / 8;
+
+                    const uint64_t input_byte_size = utility::get_file_size(file_in_handle);
+
+                    if (overlap_byte_size >= g_options.stream_byte_size && input_byte_size > g_options.stream_byte_size) {
+                        _ftprintf(stderr, _T("error: stream_byte_size must be greater than the windows overlap: stream_byte_size=%") _T(PRIu64) _T(" overlap_byte_size=%") _T(PRIu64) _T("\n"),
+                            g_options.stream_byte_size, overlap_byte_size);
+                        return 255;
+                    }
+
+                    // Buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
+                    // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+                    //
+                    const uint64_t padded_window_byte_size = ((g_options.stream_byte_size + 3) & ~uint64_t(3)) + 4;
+
+                    SyncWindowData sync_window_data{
+                        BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
+                        StreamParams{ padded_window_byte_size, 0, 0 },
+                        CorrInParams{
+                            g_options.impl_token,
+                            g_options.corr_mm,
+                            g_options.simd_token,
+                            g_options.corr_value_token,
+                            g_options.stream_bit_size,      // window bit size
+                            g_options.syncseq_bit_size,
+                            g_options.corr_min,
+                            g_options.corr_mean_min,
+                            g_options.stream_min_period,
+                            g_options.stream_max_period,
+                            g_options.syncseq_min_repeat,
+                            g_options.syncseq_max_repeat,
+                            g_options.max_periods_in_offset,
+                            g_options.max_corr_values_per_period,
+                            size_t(g_options.corr_mean_buf_max_size_mb * 1024 * 1024), // 4GB max
+                            g_options.num_threads,
+                            g_options.autocorr_fft_min_size,
+                            g_flags.no_zero_corr,
+                            g_flags.use_linear_corr,
+                            g_flags.skip_calc_on_filtered_corr_value_use,
+                            g_flags.use_comb_corr_sum,
+                            g_flags.skip_max_weighted_sum_of_corr_mean_calc,
+                            g_flags.sort_at_first_by_max_corr_mean,
+                            g_flags.return_sorted_result
+                        },
+                        CorrInOutParams{
+                            g_options.syncseq_int32         // CAUTION: bit length can be greater than `syncseq_bit_size`
+                        },
+                        CorrOutParams{},
+                        input_byte_size,
+                        uint32_t(g_options.stream_byte_size),
+                        uint32_t((std::min)(overlap_byte_size, g_options.stream_byte_size)), // a single window has no overlap to step over
+                        0,
+                        0,
+                        0,
+                        0
+                    };
+
+                    search_synchro_sequence_windows(sync_window_data, file_in_handle.get());
+
+                    fmt::print(
+                        _T(
+                            "\n"
+                            "impl token:                    {:d} / {:s}\n"
+                            "syncseq length/value:          {:d} / {:#010x}\n"
+                            "windows locked/all:            {:d} / {:d}\n"
+                            "period changes:                {:d}\n"
+                            "max abs drift:                 {:d}\n"
+                            "stream bit length:             {:d}\n"
+                            "window/overlap bit length:     {:d} / {:d}\n"
+                            "period {{in}} min/max:           {:d} / {:d}\n"
+                            "period {{io}} min/max:           {:d} / {:d}\n"
+                            "user corr value/mean min:      {:#06f} / {:#06f}\n"
+                            "corr value min/max:            {:s} / {:#06f}\n"
+                            "threads:                       {:s}\n"
+                            "num corr values calc/iter:     {:d} / {:d}\n"
+                            "input noise pttn bits/prob:    {:s}\n"
+                        ),
+                        sync_window_data.corr_in_params.impl_token, !g_options.impl_token_str.empty() ? g_options.impl_token_str : std::tstring{ _T("-") },
+                        g_options.syncseq_bit_size, sync_window_data.corr_io_params.syncseq_int32,
+                        sync_window_data.num_locked_windows, sync_window_data.num_windows,
+                        sync_window_data.num_period_changes,
+                        sync_window_data.max_abs_drift,
+                        input_byte_size * 8,
+                        uint64_t(sync_window_data.window_byte_size) * 8, uint64_t(sync_window_data.overlap_byte_size) * 8,
+                        sync_window_data.corr_in_params.min_period, sync_window_data.corr_in_params.max_period,
+                        sync_window_data.corr_out_params.min_period, sync_window_data.corr_out_params.max_period,
+                        sync_window_data.corr_in_params.corr_min, sync_window_data.corr_in_params.corr_mean_min,
+                        sync_window_data.corr_out_params.min_corr_value != math::float_max ?
+                            fmt::format(_T("{:#06f}"), sync_window_data.corr_out_params.min_corr_value) :
+                            _T("-"),
+                        sync_window_data.corr_out_params.max_corr_value,
+                        g_options.num_threads ?
+                            std::to_tstring(g_options.num_threads) :
+                            std::tstring{ _T("all") },
+                        sync_window_data.corr_out_params.num_corr_values_calc,
+                        sync_window_data.corr_out_params.num_corr_values_iterated,
+                        g_options.gen_input_noise_bit_block_size ?
+                            fmt::format(_T("{:d} / {:#03d} %"), g_options.gen_input_noise_bit_block_size, g_options.gen_input_noise_block_bit_prob) :
+                            _T("-"));
+
+                    ret = 0;
+                } break;
+
+                case Mode_Sync_Batch:
+                {
+                    SyncBatchData sync_batch_data{
+                        BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
+                        CorrInParams{
+                            g_options.impl_token,
+                            g_options.corr_mm,
+                            g_options.simd_token,
+                            g_options.corr_value_token,
+                            0,                              // input file bit size
+                            g_options.syncseq_bit_size,
+                            g_options.corr_min,
+                            g_options.corr_mean_min,
+                            g_options.stream_min_period,
+                            g_options.stream_max_period,
+                            g_options.syncseq_min_repeat,
+                            g_options.syncseq_max_repeat,
+                            g_options.max_periods_in_offset,
+                            g_options.max_corr_values_per_period,
+                            size_t(g_options.corr_mean_buf_max_size_mb * 1024 * 1024), // 4GB max
+                            g_options.num_threads,
+                            g_options.autocorr_fft_min_size,
+                            g_flags.no_zero_corr,
+                            g_flags.use_linear_corr,
+                            g_flags.skip_calc_on_filtered_corr_value_use,
+                            g_flags.use_comb_corr_sum,
+                            g_flags.skip_max_weighted_sum_of_corr_mean_calc,
+                            g_flags.sort_at_first_by_max_corr_mean,
+                            g_flags.return_sorted_result
+                        },
+                        CorrInOutParams{
+                            g_options.syncseq_int32         // CAUTION: bit length can be greater than `syncseq_bit_size`
+                        },
+                        CorrOutParams{},
+                        &g_options.input_file_arr,
+                        0,
+                        0
+                    };
+
+                    search_synchro_sequence_batch(sync_batch_data);
+
+                    fmt::print(
+                        _T(
+                            "\n"
+                            "impl token:                    {:d} / {:s}\n"
+                            "syncseq length/value:          {:d} / {:#010x}\n"
+                            "files locked/failed/all:       {:d} / {:d} / {:d}\n"
+                            "max stream bit length:         {:s}\n"
+                            "period {{in}} min/max:           {:d} / {:s}\n"
+                            "user corr value/mean min:      {:#06f} / {:#06f}\n"
+                            "corr value min/max:            {:s} / {:#06f}\n"
+                            "threads:                       {:s}\n"
+                            "num corr values calc/iter:     {:d} / {:d}\n"
+                            "input noise pttn bits/prob:    {:s}\n"
+                        ),
+                        sync_batch_data.corr_in_params.impl_token, !g_options.impl_token_str.empty() ? g_options.impl_token_str : std::tstring{ _T("-") },
+                        g_options.syncseq_bit_size, sync_batch_data.corr_io_params.syncseq_int32,
+                        sync_batch_data.num_locked_files, sync_batch_data.num_failed_files, g_options.input_file_arr.size(),
+                        g_options.stream_byte_size ?
+                            std::to_tstring(g_options.stream_byte_size * 8) :
+                            _T("-"),
+                        sync_batch_data.corr_in_params.min_period,
+                        sync_batch_data.corr_in_params.max_period != math::uint32_max ?
+                            std::to_tstring(sync_batch_data.corr_in_params.max_period) :
+                            _T("-"),
+                        sync_batch_data.corr_in_params.corr_min, sync_batch_data.corr_in_params.corr_mean_min,
+                        sync_batch_data.corr_out_params.min_corr_value != math::float_max ?
+                            fmt::format(_T("{:#06f}"), sync_batch_data.corr_out_params.min_corr_value) :
+                            _T("-"),
+                        sync_batch_data.corr_out_params.max_corr_value,
+                        g_options.num_threads ?
+                            std::to_tstring(g_options.num_threads) :
+                            std::tstring{ _T("all") },
+                        sync_batch_data.corr_out_params.num_corr_values_calc,
+                        sync_batch_data.corr_out_params.num_corr_values_iterated,
+                        g_options.gen_input_noise_bit_block_size ?
+                            fmt::format(_T("{:d} / {:#03d} %"), g_options.gen_input_noise_bit_block_size, g_options.gen_input_noise_block_bit_prob) :
+                            _T("-"));
+
+                    ret = !sync_batch_data.num_failed_files ? 0 : 255;
+                } break;
+
+                case Mode_Gen_Sync:
+                case Mode_Sync_Remap:
+                {
+                    // Buffer must be padded to a multiple of 4 bytes plus 4 bytes reminder to be able to read and shift the last 32-bit block as 64-bit block.
+                    // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
+                    //
+                    const uint64_t padded_stream_byte_size = ((g_options.stream_byte_size + 3) & ~uint64_t(3)) + 4;
+
+                    GenSyncData gen_sync_data{
+                        BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
+                        &baud_alphabet_start_sequence,
+                        &baud_alphabet_sequences,
+                        baud_mask,
+                        baud_capacity,
+                        gen_bit_shift,
+                        gen_combination_variant,
+                        StreamParams{ padded_stream_byte_size, 0, 0 },
+                        NoiseParams{},
+                        CorrInParams{
+                            g_options.impl_token,
+                            g_options.corr_mm,
+                            g_options.simd_token,
+                            g_options.corr_value_token,
+                            uint64_t(g_options.stream_byte_size) * 8,
+                            g_options.syncseq_bit_size,
+                            g_options.corr_min,
+                            g_options.corr_mean_min,
+                            g_options.stream_min_period,
+                            g_options.stream_max_period,
+                            g_options.syncseq_min_repeat,
+                            g_options.syncseq_max_repeat,
+                            g_options.max_periods_in_offset,
+                            g_options.max_corr_values_per_period,
+                            size_t(g_options.corr_mean_buf_max_size_mb * 1024 * 1024), // 4GB max
+                            g_options.num_threads,
+                            g_options.autocorr_fft_min_size,
+                            g_flags.no_zero_corr,
+                            g_flags.use_linear_corr,
+                            g_flags.skip_calc_on_filtered_corr_value_use,
+                            g_flags.use_comb_corr_sum,
+                            g_flags.skip_max_weighted_sum_of_corr_mean_calc,
+                            g_flags.sort_at_first_by_max_corr_mean,
+                            g_flags.return_sorted_result
+                        },
+                        CorrInOutParams{
+                            g_options.syncseq_int32         // CAUTION: bit length can be greater than `syncseq_bit_size`
+                        },
+                        CorrOutParams{},
+                        {},
+                        0,
+                        {}
+                    };
+
+                    ReadFileChunkData read_file_chunk_data{ mode, &gen_sync_data };
+
+                    fseek(file_in_handle.get(), 0, SEEK_SET); // just in case
+                    tackle::file_reader<TCHAR>(file_in_handle, read_file_chunk).do_read(&read_file_chunk_data, { g_options.stream_byte_size }, padded_stream_byte_size);
+
+                    // the variants are ranked by the mean of the top correlation values of the remapped synchro sequence
+                    for (const auto & remap_variant : gen_sync_data.remap_variant_arr) {
+                        fmt::print(
+                            _T("#{:d}-{:d}: remapped syncseq/max corr offset/max corr/top corr mean: {:#010x} / {:s} / {:#06f} / {:#06f}\n"),
+                            remap_variant.shifted_bit_offset, remap_variant.baud_alphabet_sequence_index,
+                            remap_variant.syncseq_int32,
+                            remap_variant.max_corr_offset != math::uint64_max ? std::to_tstring(remap_variant.max_corr_offset) : _T("-"),
+                            remap_variant.max_corr_value, remap_variant.top_corr_mean);
+                    }
+
+                    if (!gen_sync_data.remap_variant_arr.empty()) {
+                        fmt::print(_T("\n"));
+                    }
+
+                    uint32_t num_found_variants = 0;
+
+                    // the variants are ranked by the correlation mean value
+                    for (const auto & gen_sync_result : gen_sync_data.result_arr) {
+                        const bool is_found = gen_sync_result.syncseq_bit_offset != math::uint64_max && gen_sync_result.stream_width != math::uint32_max;
+
+                        if (is_found) {
+                            num_found_variants++;
+                        }
+
+                        std::tstring offset_suffix_msg_str;
+
+                        if (gen_sync_result.input_inconsistency) {
+                            offset_suffix_msg_str += _T(" [INPUT INCONSISTENCY]");
+                        }
+                        if (gen_sync_result.uncertain) {
+                            offset_suffix_msg_str += _T(" [UNCERTAIN]");
+                        }
+                        if (gen_sync_result.disagreement) {
+                            offset_suffix_msg_str += _T(" [DISAGREEMENT]");
+                        }
+
+                        fmt::print(
+                            _T("#{:d}-{:d}: offset/period/corr mean: {:s} / {:s} / {:s}{:s}\n"),
+                            gen_sync_result.shifted_bit_offset, gen_sync_result.baud_alphabet_sequence_index,
+                            is_found ? std::to_tstring(gen_sync_result.syncseq_bit_offset) : _T("-"),
+                            is_found ? std::to_tstring(gen_sync_result.stream_width) : _T("-"),
+                            gen_sync_result.corr_mean != math::float_max ? fmt::format(_T("{:#06f}"), gen_sync_result.corr_mean) : _T("-"),
+                            offset_suffix_msg_str);
+
+                        for (uint32_t k = 0; k < baud_capacity; k++) {
+                            const uint32_t from_baud = baud_alphabet_start_sequence[k];
+                            const uint32_t to_baud = baud_alphabet_sequences[gen_sync_result.baud_alphabet_sequence_index][k];
+                            if (from_baud != to_baud) {
+                                fmt::print(
+                                    _T("  {0:#0{2}b} -> {1:#0{2}b}\n"), from_baud, to_baud, 2 + g_options.bits_per_baud);
+                            }
+                        }
+                    }
+
+                    fmt::print(
+                        _T(
+                            "\n"
+                            "impl token:                    {:d} / {:s}\n"
+                            "syncseq length/value:          {:d} / {:#010x}\n"
+                            "variants found/all:            {:d} / {:d}\n"
+                            "remap top corr values:         {:s}\n"
+                            "stream bit length:             {:d}\n"
+                            "period {{in}} min/max:           {:d} / {:s}\n"
+                            "user corr value/mean min:      {:#06f} / {:#06f}\n"
+                            "corr value min/max:            {:s} / {:#06f}\n"
+                            "threads:                       {:s}\n"
+                            "num corr values calc/iter:     {:d} / {:d}\n"
+                            "input noise pttn bits/prob:    {:s}\n"
+                        ),
+                        gen_sync_data.corr_in_params.impl_token, !g_options.impl_token_str.empty() ? g_options.impl_token_str : std::tstring{ _T("-") },
+                        g_options.syncseq_bit_size, gen_sync_data.corr_io_params.syncseq_int32,
+                        num_found_variants, gen_sync_data.result_arr.size(),
+                        mode == Mode_Sync_Remap ?
+                            std::to_tstring(gen_sync_data.num_top_corr_values) :
+                            _T("-"),
+                        g_options.stream_byte_size * 8,
+                        gen_sync_data.corr_in_params.min_period,
+                        gen_sync_data.corr_in_params.max_period != math::uint32_max ?
+                            std::to_tstring(gen_sync_data.corr_in_params.max_period) :
+                            _T("-"),
+                        gen_sync_data.corr_in_params.corr_min, gen_sync_data.corr_in_params.corr_mean_min,
+                        gen_sync_data.corr_out_params.min_corr_value != math::float_max ?
+                            fmt::format(_T("{:#06f}"), gen_sync_data.corr_out_params.min_corr_value) :
+                            _T("-"),
+                        gen_sync_data.corr_out_params.max_corr_value,
+                        g_options.num_threads ?
+                            std::to_tstring(g_options.num_threads) :
+                            std::tstring{ _T("all") },
+                        gen_sync_data.corr_out_params.num_corr_values_calc,
+                        gen_sync_data.corr_out_params.num_corr_values_iterated,
+                        g_options.gen_input_noise_bit_block_size ?
+                            fmt::format(_T("{:d} / {:#03d} %"), g_options.gen_input_noise_bit_block_size, g_options.gen_input_noise_block_bit_prob) :
+                            _T("-"));
+
+                    ret = 0;
+                } break;
+
                 case Mode_Pipe:
                 {
                     // Buffer must be padded to 3 bytes remainder to be able to read and shift the last 8-bit block as 32-bit block.
                     //
-                    const uint32_t padded_stream_byte_size = g_options.stream_byte_size + 3;
+                    const uint32_t padded_stream_byte_size = uint32_t(g_options.stream_byte_size + 3);
 
                     PipeData pipe_data{
                         BasicData{ &g_flags, &g_options, mode, tee_file_in_handle },
@@ -0,0 +1,140 @@
+// Author: Andrey Dibrov (andry at inbox dot ru)
+//
+
+#include "radix_sort.hpp"
+#include "work_stealing_pool.hpp"
+
+#include <algorithm>
+#include <functional>
+
+
+namespace {
+
+    const size_t radix_digit_bits = 8;
+    const size_t radix_digit_size = size_t(1) << radix_digit_bits;
+    const size_t radix_num_key_words = sizeof(RadixSortKey::key) / sizeof(RadixSortKey::key[0]);
+    const size_t radix_num_digits = sizeof(RadixSortKey::key) * 8 / radix_digit_bits;
+
+    // minimal number of keys in a part to sort in parallel
+    const size_t radix_min_part_size = 65536;
+
+    inline uint32_t get_radix_digit(const RadixSortKey & key, size_t digit_index)
+    {
+        return (key.key[digit_index / 4] >> (digit_index % 4 * radix_digit_bits)) & (radix_digit_size - 1);
+    }
+
+    void radix_sort_parts(WorkStealingPool * pool_ptr, size_t num_parts, std::vector<RadixSortKey> & key_arr, std::vector<RadixSortKey> & buf_arr)
+    {
+        const size_t num_keys = key_arr.size();
+
+        if (num_keys < 2) {
+            return;
+        }
+
+        // find digits with different values, so the passes of other digits can be skipped
+
+        uint32_t key_and_arr[radix_num_key_words];
+        uint32_t key_or_arr[radix_num_key_words];
+
+        for (size_t i = 0; i < radix_num_key_words; i++) {
+            key_and_arr[i] = uint32_t(~0U);
+            key_or_arr[i] = 0;
+        }
+
+        for (const auto & key : key_arr) {
+            for (size_t i = 0; i < radix_num_key_words; i++) {
+                key_and_arr[i] &= key.key[i];
+                key_or_arr[i] |= key.key[i];
+            }
+        }
+
+        buf_arr.resize(num_keys);
+
+        // digit histograms of parts, then the digit offsets of parts
+        std::vector<size_t> part_digit_hist_arr(num_parts * radix_digit_size);
+
+        const auto get_part_begin = [&](size_t part_index) -> size_t {
+            return num_keys / num_parts * part_index + (std::min)(num_keys % num_parts, part_index);
+        };
+
+        const auto run_parts = [&](const std::function<void(size_t part_index)> & part_func) {
+            if (pool_ptr && num_parts > 1) {
+                pool_ptr->run(num_parts, [&](size_t, uint64_t part_index) {
+                    part_func(size_t(part_index));
+                });
+            }
+            else {
+                for (size_t part_index = 0; part_index < num_parts; part_index++) {
+                    part_func(part_index);
+                }
+            }
+        };
+
+        RadixSortKey * from_arr = key_arr.data();
+        RadixSortKey * to_arr = buf_arr.data();
+
+        for (size_t digit_index = 0; digit_index < radix_num_digits; digit_index++) {
+            const size_t digit_shift = digit_index % 4 * radix_digit_bits;
+
+            if (!(((key_and_arr[digit_index / 4] ^ key_or_arr[digit_index / 4]) >> digit_shift) & (radix_digit_size - 1))) {
+                continue;
+            }
+
+            run_parts([&](size_t part_index) {
+                size_t * digit_hist_arr = &part_digit_hist_arr[part_index * radix_digit_size];
+
+                std::fill(digit_hist_arr, digit_hist_arr + radix_digit_size, 0);
+
+                const size_t part_end = get_part_begin(part_index + 1);
+
+                for (size_t i = get_part_begin(part_index); i < part_end; i++) {
+                    digit_hist_arr[get_radix_digit(from_arr[i], digit_index)]++;
+                }
+            });
+
+            // the digit offsets of parts in the order of digits and then parts to keep the sort stable
+
+            size_t digit_offset = 0;
+
+            for (size_t digit = 0; digit < radix_digit_size; digit++) {
+                for (size_t part_index = 0; part_index < num_parts; part_index++) {
+                    size_t & digit_hist_ref = part_digit_hist_arr[part_index * radix_digit_size + digit];
+
+                    const size_t digit_count = digit_hist_ref;
+
+                    digit_hist_ref = digit_offset;
+                    digit_offset += digit_count;
+                }
+            }
+
+            run_parts([&](size_t part_index) {
+                size_t * digit_offset_arr = &part_digit_hist_arr[part_index * radix_digit_size];
+
+                const size_t part_end = get_part_begin(part_index + 1);
+
+                for (size_t i = get_part_begin(part_index); i < part_end; i++) {
+                    to_arr[digit_offset_arr[get_radix_digit(from_arr[i], digit_index)]++] = from_arr[i];
+                }
+            });
+
+            std::swap(from_arr, to_arr);
+        }
+
+        if (from_arr != key_arr.data()) {
+            key_arr.swap(buf_arr);
+        }
+    }
+
+}
+
+void radix_sort(std::vector<RadixSortKey> & key_arr, std::vector<RadixSortKey> & buf_arr)
+{
+    radix_sort_parts(nullptr, 1, key_arr, buf_arr);
+}
+
+void radix_sort(WorkStealingPool & pool, std::vector<RadixSortKey> & key_arr, std::vector<RadixSortKey> & buf_arr)
+{
+    const size_t num_parts = (std::max)((std::min)(pool.num_workers(), key_arr.size() / radix_min_part_size), size_t(1));
+
+    radix_sort_parts(&pool, num_parts, key_arr, buf_arr);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+
+class WorkStealingPool;
+
+// Composite 128-bit key of a record to sort in the ascending order and the index of the record in the not sorted container.
+//
+struct RadixSortKey
+{
+    uint32_t                        key[4];                         // key words from the least significant to the most significant
+    uint32_t                        index;                          // record index
+};
+
+// Maps a float value into an unsigned key with the same order, where the negative zero is mapped as the positive zero.
+// To sort from maximum to minimum the key must be inverted.
+//
+inline uint32_t float_to_radix_key(float value)
+{
+    if (!value) {
+        return 0x80000000U;
+    }
+
+    uint32_t bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return (bits & 0x80000000U) ? ~bits : bits | 0x80000000U;
+}
+
+// Stable LSD radix sort of the keys by 8-bit digits, where a digit pass is skipped if all the keys have the same digit.
+// The buffer is used as a second half of the key array and can be reused between calls.
+//
+//  Memory complexity:   O(N)
+//  Time complexity:     O(N * D), where N - number of keys, D - number of not equal digits (16 maximum)
+//
+void radix_sort(std::vector<RadixSortKey> & key_arr, std::vector<RadixSortKey> & buf_arr);
+
+// The same, but the key array is split into parts between the pool workers to calculate the digit histograms and to scatter the keys in parallel.
+// The result is the same as of the single thread sort.
+//
+void radix_sort(WorkStealingPool & pool, std::vector<RadixSortKey> & key_arr, std::vector<RadixSortKey> & buf_arr);
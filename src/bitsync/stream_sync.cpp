@@ -0,0 +1,561 @@
+// Author: Andrey Dibrov (andry at inbox dot ru)
+//
+
+#include "stream_sync.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <cstring>
+#include <cmath>
+
+
+namespace {
+    // The excess of a correlation mean value over the window correlation mean value multiplied by the square root of the number of values.
+    // The excess of a divided by K period is K times less for K times more values and the excess of a multiplied by K period is the same for
+    // K times less values, so both have less weight than the period.
+    //
+    inline double get_corr_mean_weight(float corr_mean, uint32_t num_corr, float window_corr_mean)
+    {
+        return (double(corr_mean) - window_corr_mean) * std::sqrt(double(num_corr));
+    }
+}
+
+StreamSyncTracker::StreamSyncTracker(
+    const CorrInParams & corr_in_params, const StreamTrackParams & track_params, CorrInOutParams & corr_io_params, CorrOutParams & corr_out_params) :
+    m_corr_in_params(corr_in_params),
+    m_track_params(track_params),
+    m_window_bit_size(corr_in_params.stream_bit_size),
+    m_stream_bit_size(0),
+    m_min_period(0),
+    m_max_period(0),
+    m_min_num_corr(0),
+    m_input_inconsistency(false),
+    m_corr_multiply_table_ptr{ new CorrMultiplyTable },
+    m_corr_simd_kernels_ptr(&get_corr_simd_kernels(corr_in_params.simd_token)),
+    m_corr_values_block_params{},
+    m_corr_values_block_stats{ math::float_max, 0, 0 },
+    m_syncseq_mask(0),
+    m_corr_value_scale(0),
+    m_fixed_corr_min(0),
+    m_fixed_filtered_corr_value(0),
+    m_stream_buf_size(0),
+    m_window_corr_sum(0),
+    m_window_first_offset(0),
+    m_num_period_sums(0),
+    m_lock{},
+    m_is_tracking(false),
+    m_track_drift_bit_size(0),
+    m_track_offset(0),
+    m_track_num_misses(0),
+    m_track_corr_sum(0),
+    m_num_reacquisitions(0),
+    m_pool(corr_in_params.num_threads)
+{
+    const uint64_t window_bit_size = m_window_bit_size;
+    const auto syncseq_bit_size = corr_in_params.syncseq_bit_size;
+
+    m_syncseq_mask = uint32_t(~(~uint64_t(0) << syncseq_bit_size));
+
+    const uint32_t syncseq_bytes = corr_io_params.syncseq_int32 & m_syncseq_mask;
+
+    // write back
+    corr_io_params.syncseq_int32 = syncseq_bytes;
+
+    assert(window_bit_size);
+    assert(syncseq_bit_size);
+    assert(syncseq_bit_size < window_bit_size); // must be greater
+
+    // The same periods as of a stream of the window bit length, but the number of repeats is limited only by the window.
+    //
+    const auto syncseq_min_repeat = corr_in_params.period_min_repeat ? corr_in_params.period_min_repeat : 1;
+
+    uint64_t stream_min_period =
+        (std::min)(
+            uint64_t(corr_in_params.min_period ? (std::max)(syncseq_bit_size + 1, corr_in_params.min_period) : syncseq_bit_size * 2),
+            window_bit_size - 1);
+    uint64_t stream_max_period =
+        (std::min)(
+            uint64_t(corr_in_params.max_period != math::uint32_max ? (std::max)(syncseq_bit_size + 1, corr_in_params.max_period) : window_bit_size * 2),
+            window_bit_size - 1);
+
+    // align maximum period by minimum period
+    stream_max_period = (std::max)(stream_max_period, stream_min_period);
+
+    const uint64_t stream_max_period_for_min_repeat = (window_bit_size - 1) / syncseq_min_repeat;
+
+    stream_min_period = (std::min)(stream_min_period, stream_max_period_for_min_repeat);
+    stream_max_period = (std::min)(stream_max_period, stream_max_period_for_min_repeat);
+
+    // just in case
+    stream_min_period = (std::min)(stream_min_period, uint64_t(math::uint32_max));
+    stream_max_period = (std::min)(stream_max_period, uint64_t(math::uint32_max));
+
+    // write back for user notification
+    corr_out_params.min_period = uint32_t(stream_min_period);
+    corr_out_params.max_period = uint32_t(stream_max_period);
+
+    if ((corr_in_params.min_period && corr_in_params.min_period != math::uint32_max && corr_in_params.min_period < stream_min_period) ||
+        (corr_in_params.max_period != math::uint32_max && stream_max_period < corr_in_params.max_period) ||
+        syncseq_bit_size >= stream_min_period) {
+        // important input condition is changed and reduced the field of search of the result or not enough room for calculation
+        corr_out_params.input_inconsistency = m_input_inconsistency = true;
+        return;
+    }
+
+    m_min_period = uint32_t(stream_min_period);
+    m_max_period = uint32_t(stream_max_period);
+    m_min_num_corr = syncseq_min_repeat + 1;
+
+    const size_t num_periods = size_t(m_max_period - m_min_period + 1);
+
+    m_period_sum_offset_arr.resize(num_periods);
+
+    for (size_t i = 0; i < num_periods; i++) {
+        m_period_sum_offset_arr[i] = m_num_period_sums;
+        m_num_period_sums += m_min_period + i;
+    }
+
+    // correlation values calculation as in the Phase 1 of the `calculate_syncseq_correlation` with the fixed point values
+
+    make_corr_multiply_table(corr_in_params.corr_mm, syncseq_bytes, syncseq_bit_size, *m_corr_multiply_table_ptr);
+
+    // absolute maximum for the synchro sequence bits by the table of the synchro sequence
+    const float syncseq_corr_absmax = multiply_bits(m_corr_multiply_table_ptr->syncseq_arr, syncseq_bytes);
+
+    m_corr_value_scale = corr_in_params.corr_value_token == Impl::corr_value_fixed8 ?
+        float((std::numeric_limits<uint8_t>::max)()) : float((std::numeric_limits<uint16_t>::max)());
+
+    const float corr_min = corr_in_params.corr_min;
+    const bool use_linear_corr = corr_in_params.use_linear_corr;
+
+    // a value to replace a correlation value filtered by the correlation minimum
+    const float filtered_corr_value = !corr_in_params.no_zero_corr ?
+        0 : (corr_min ? corr_min : (use_linear_corr ? DEFAULT_LINEAR_CORR_MIN : DEFAULT_QUADRATIC_CORR_MIN));
+
+    // the fixed point correlation values are filtered after the conversion in the integer domain
+    m_corr_values_block_params = CorrValuesBlockParams{ syncseq_corr_absmax, 0, 0, use_linear_corr };
+
+    m_fixed_corr_min = quantize_corr_value(corr_min, m_corr_value_scale);
+    m_fixed_filtered_corr_value = quantize_corr_value(filtered_corr_value, m_corr_value_scale);
+}
+
+bool StreamSyncTracker::push_bytes(const uint8_t * buf, size_t size, CorrOutParams & corr_out_params)
+{
+    if (m_input_inconsistency || !size) {
+        return false;
+    }
+
+    // allocate by the first push, so the buffers size can be checked before
+    if (m_period_sum_arr.empty()) {
+        m_corr_value_ring_arr.resize(size_t(m_window_bit_size));
+        m_period_sum_arr.resize(m_num_period_sums);
+        m_period_lock_arr.resize(m_period_sum_offset_arr.size());
+    }
+
+    m_stream_buf.resize(m_stream_buf_size + size + 8);
+
+    std::memcpy(m_stream_buf.data() + m_stream_buf_size, buf, size);
+
+    m_stream_buf_size += size;
+
+    bool is_lock_changed = false;
+
+    if (m_is_tracking) {
+        is_lock_changed = track_lock(corr_out_params);
+
+        // continue by the acquisition on the lock drop
+        if (m_is_tracking) {
+            return is_lock_changed;
+        }
+    }
+
+    if (acquire_lock(corr_out_params)) {
+        is_lock_changed = true;
+    }
+
+    return is_lock_changed;
+}
+
+bool StreamSyncTracker::acquire_lock(CorrOutParams & corr_out_params)
+{
+    const size_t num_blocks32 = m_stream_buf_size / 4;
+
+    if (num_blocks32 < 2) {
+        return false;
+    }
+
+    // the offsets of a 32-bit block are calculated from the block and the next block
+    const size_t num_new_values = (num_blocks32 - 1) * 32;
+
+    calculate_corr_values(num_blocks32 - 1, corr_out_params);
+
+    // move the not processed bytes to the begin
+    const size_t processed_size = (num_blocks32 - 1) * 4;
+
+    std::memmove(m_stream_buf.data(), m_stream_buf.data() + processed_size, m_stream_buf_size - processed_size);
+
+    m_stream_buf_size -= processed_size;
+
+    const uint64_t first_offset = m_stream_bit_size;
+    const size_t window_bit_size = size_t(m_window_bit_size);
+    const size_t first_ring_index = size_t(first_offset % m_window_bit_size);
+
+    // the values falling out of the window, where the value of an offset falling out is in the same ring index as of the new offset
+    m_old_corr_value_arr.resize(num_new_values);
+
+    for (size_t i = 0, ring_index = first_ring_index; i < num_new_values; i++) {
+        if (first_offset + i - m_window_first_offset < m_window_bit_size) {
+            m_old_corr_value_arr[i] = 0;
+        }
+        else if (i >= window_bit_size) {
+            m_old_corr_value_arr[i] = m_new_corr_value_arr[i - window_bit_size];
+        }
+        else {
+            m_old_corr_value_arr[i] = m_corr_value_ring_arr[ring_index];
+        }
+
+        m_window_corr_sum += m_new_corr_value_arr[i];
+        m_window_corr_sum -= m_old_corr_value_arr[i];
+
+        if (++ring_index == window_bit_size) {
+            ring_index = 0;
+        }
+    }
+
+    const uint64_t stream_bit_size = first_offset + num_new_values;
+
+    const float window_corr_mean = float(double(m_window_corr_sum) / (double(m_window_bit_size) * m_corr_value_scale));
+
+    // the periods are independent between each other
+    m_pool.run(m_period_lock_arr.size(), [&](size_t, uint64_t period_index) {
+        update_period(size_t(period_index), first_offset, num_new_values, window_corr_mean, m_period_lock_arr[size_t(period_index)]);
+    });
+
+    for (size_t i = 0, ring_index = first_ring_index; i < num_new_values; i++) {
+        m_corr_value_ring_arr[ring_index] = m_new_corr_value_arr[i];
+
+        if (++ring_index == window_bit_size) {
+            ring_index = 0;
+        }
+    }
+
+    m_stream_bit_size = stream_bit_size;
+
+    corr_out_params.num_corr_values_iterated += num_new_values * m_period_lock_arr.size();
+
+    // the lock of the maximum weighted correlation mean value, where the lesser period has a priority
+    StreamSyncLock lock{ stream_bit_size, 0, 0, 0, 0 };
+
+    double max_corr_mean_weight = 0;
+
+    for (const auto & period_lock : m_period_lock_arr) {
+        if (!period_lock.period) {
+            continue;
+        }
+
+        const double corr_mean_weight = get_corr_mean_weight(period_lock.corr_mean, period_lock.num_corr, window_corr_mean);
+
+        if (max_corr_mean_weight < corr_mean_weight) {
+            max_corr_mean_weight = corr_mean_weight;
+            lock = period_lock;
+        }
+    }
+
+    const bool is_lock_changed =
+        lock.period != m_lock.period || (lock.period && lock.offset % lock.period != m_lock.offset % m_lock.period);
+
+    if (is_lock_changed) {
+        m_lock = lock;
+    }
+    else {
+        // the lock offset is left as of the lock change
+        m_lock.stream_bit_size = lock.stream_bit_size;
+        m_lock.num_corr = lock.num_corr;
+        m_lock.corr_mean = lock.corr_mean;
+    }
+
+    if (m_track_params.max_misses && m_lock.period) {
+        const uint32_t period = m_lock.period;
+
+        m_is_tracking = true;
+
+        // the drift ranges of the consecutive periods must not intersect
+        m_track_drift_bit_size = (std::min)(m_track_params.drift_bit_size, (period - 1) / 2);
+
+        // the first expected offset after the drift range of the processed offsets
+        const uint64_t min_track_offset = m_stream_bit_size + m_track_drift_bit_size;
+
+        m_track_offset = m_lock.offset + (min_track_offset - m_lock.offset + period - 1) / period * period;
+        m_track_num_misses = 0;
+
+        // the confidence is continued by the values of the checks
+        m_track_corr_sum = double(m_lock.corr_mean) * m_lock.num_corr;
+    }
+
+    return is_lock_changed;
+}
+
+bool StreamSyncTracker::track_lock(CorrOutParams & corr_out_params)
+{
+    const CorrMultiplyTable & corr_multiply_table = *m_corr_multiply_table_ptr;
+
+    const uint32_t period = m_lock.period;
+    const uint32_t drift_bit_size = m_track_drift_bit_size;
+    const float corr_min = m_track_params.corr_min;
+    const float filtered_corr_value = float(m_fixed_filtered_corr_value) / m_corr_value_scale;
+
+    // drops the bytes before the drift range of the expected offset, but not the bytes of the last not complete 32-bit block
+    const auto skip_stream_buf = [&]() {
+        const uint64_t first_offset = (m_track_offset - drift_bit_size) / 32 * 32;
+
+        const size_t processed_size = (std::min)(size_t((first_offset - m_stream_bit_size) / 8), m_stream_buf_size / 4 * 4);
+
+        std::memmove(m_stream_buf.data(), m_stream_buf.data() + processed_size, m_stream_buf_size - processed_size);
+
+        m_stream_buf_size -= processed_size;
+        m_stream_bit_size += processed_size * 8;
+    };
+
+    skip_stream_buf();
+
+    bool is_lock_changed = false;
+
+    // the offsets of a 32-bit block are calculated from the block and the next block
+    while ((m_track_offset + drift_bit_size - m_stream_bit_size) / 32 + 2 <= m_stream_buf_size / 4) {
+        const uint32_t * stream_buf32 = (const uint32_t *)m_stream_buf.data();
+
+        // the maximum correlation value in the drift range, where the lesser drift has a priority
+        uint64_t max_corr_offset = m_track_offset;
+        float max_corr_value = 0;
+
+        for (uint32_t i = 0; i <= drift_bit_size * 2; i++) {
+            const uint64_t offset = (i & 1) ? m_track_offset - (i + 1) / 2 : m_track_offset + i / 2;
+            const uint64_t buf_bit_offset = offset - m_stream_bit_size;
+
+            const uint64_t from64 = *(const uint64_t *)(stream_buf32 + buf_bit_offset / 32);
+            const uint32_t from_shifted = uint32_t(from64 >> (buf_bit_offset % 32)) & m_syncseq_mask;
+
+            const float corr_value = calculate_corr_value(
+                multiply_bits(corr_multiply_table.syncseq_arr, from_shifted), m_corr_values_block_params.syncseq_corr_absmax,
+                multiply_bits(corr_multiply_table.stream_arr, from_shifted), m_corr_values_block_params.use_linear_corr);
+
+            m_corr_values_block_stats.min_corr_value = (std::min)(m_corr_values_block_stats.min_corr_value, corr_value);
+            m_corr_values_block_stats.max_corr_value = (std::max)(m_corr_values_block_stats.max_corr_value, corr_value);
+
+            if (max_corr_value < corr_value) {
+                max_corr_value = corr_value;
+                max_corr_offset = offset;
+            }
+        }
+
+        corr_out_params.num_corr_values_iterated += drift_bit_size * 2 + 1;
+
+        m_lock.stream_bit_size = m_track_offset + drift_bit_size + 1;
+
+        if (max_corr_value >= corr_min) {
+            corr_out_params.num_corr_values_calc++;
+
+            // the drift does change the offset remainder
+            if (max_corr_offset != m_track_offset) {
+                is_lock_changed = true;
+            }
+
+            m_lock.offset = max_corr_offset;
+            m_track_offset = max_corr_offset + period;
+            m_track_num_misses = 0;
+            m_track_corr_sum += max_corr_value;
+        }
+        else {
+            m_track_offset += period;
+            m_track_corr_sum += filtered_corr_value;
+
+            if (++m_track_num_misses >= m_track_params.max_misses) {
+                m_num_reacquisitions++;
+
+                m_lock = StreamSyncLock{ m_lock.stream_bit_size, 0, 0, 0, 0 };
+                m_is_tracking = false;
+
+                // the window is filled from the not processed stream
+                reset_window();
+
+                is_lock_changed = true;
+                break;
+            }
+        }
+
+        m_lock.num_corr = m_lock.num_corr < math::uint32_max ? m_lock.num_corr + 1 : m_lock.num_corr;
+        m_lock.corr_mean = float(m_track_corr_sum / m_lock.num_corr);
+
+        skip_stream_buf();
+    }
+
+    corr_out_params.min_corr_value = m_corr_values_block_stats.min_corr_value;
+    corr_out_params.max_corr_value = m_corr_values_block_stats.max_corr_value;
+
+    return is_lock_changed;
+}
+
+void StreamSyncTracker::reset_window()
+{
+    std::fill(m_corr_value_ring_arr.begin(), m_corr_value_ring_arr.end(), uint16_t(0));
+    std::fill(m_period_sum_arr.begin(), m_period_sum_arr.end(), uint64_t(0));
+
+    m_window_corr_sum = 0;
+    m_window_first_offset = m_stream_bit_size;
+}
+
+void StreamSyncTracker::calculate_corr_values(size_t num_blocks32, CorrOutParams & corr_out_params)
+{
+    const size_t num_new_values = num_blocks32 * 32;
+
+    m_new_corr_value_arr.resize(num_new_values);
+
+    const uint32_t * stream_buf32 = (const uint32_t *)m_stream_buf.data();
+
+    const CorrMultiplyTable & corr_multiply_table = *m_corr_multiply_table_ptr;
+    const CorrSimdKernels & corr_simd_kernels = *m_corr_simd_kernels_ptr;
+
+    size_t num_corr_values_calc = 0;
+
+    float stream_corr_absmax_arr[CORR_BLOCK_BIT_SIZE];
+    float multiplied_values_arr[CORR_BLOCK_BIT_SIZE];
+    float corr_values_block_arr[CORR_BLOCK_BIT_SIZE];
+
+    for (size_t block_offset = 0; block_offset < num_new_values; block_offset += CORR_BLOCK_BIT_SIZE) {
+        const size_t block_size = (std::min)(size_t(CORR_BLOCK_BIT_SIZE), num_new_values - block_offset);
+
+        const uint32_t * stream_block_buf32 = stream_buf32 + block_offset / 32;
+
+        corr_simd_kernels.multiply_bits_block(corr_multiply_table.stream_arr, stream_block_buf32, m_syncseq_mask, block_size, stream_corr_absmax_arr);
+        corr_simd_kernels.multiply_bits_block(corr_multiply_table.syncseq_arr, stream_block_buf32, m_syncseq_mask, block_size, multiplied_values_arr);
+
+        corr_simd_kernels.calculate_corr_values_block(m_corr_values_block_params, multiplied_values_arr, stream_corr_absmax_arr, block_size,
+            corr_values_block_arr, m_corr_values_block_stats);
+        quantize_corr_values_block(corr_values_block_arr, block_size, m_corr_value_scale, m_fixed_corr_min, m_fixed_filtered_corr_value,
+            m_new_corr_value_arr.data() + block_offset, num_corr_values_calc);
+    }
+
+    corr_out_params.num_corr_values_calc += num_corr_values_calc;
+
+    corr_out_params.min_corr_value = m_corr_values_block_stats.min_corr_value;
+    corr_out_params.max_corr_value = m_corr_values_block_stats.max_corr_value;
+}
+
+void StreamSyncTracker::update_period(size_t period_index, uint64_t first_offset, size_t num_new_values, float window_corr_mean, StreamSyncLock & period_lock)
+{
+    const uint32_t period = m_min_period + uint32_t(period_index);
+
+    uint64_t * sum_arr = m_period_sum_arr.data() + m_period_sum_offset_arr[period_index];
+
+    const uint16_t * new_corr_value_arr = m_new_corr_value_arr.data();
+    const uint16_t * old_corr_value_arr = m_old_corr_value_arr.data();
+
+    // offset remainders of the first new offset and of the first offset falling out of the window
+    const uint32_t new_remainder = uint32_t(first_offset % period);
+    const uint32_t old_remainder = uint32_t((new_remainder + period - m_window_bit_size % period) % period);
+
+    // The values are added and subtracted by separate passes of the ranges of consecutive remainders, so the loops have no branches.
+    // The subtract of a value is always after the add of the value.
+    //
+    const auto update_sums = [&](const uint16_t * corr_value_arr, uint32_t remainder, bool is_subtract) {
+        for (size_t i = 0; i < num_new_values; ) {
+            const size_t range_size = (std::min)(size_t(period - remainder), num_new_values - i);
+
+            uint64_t * range_sum_arr = sum_arr + remainder;
+            const uint16_t * range_corr_value_arr = corr_value_arr + i;
+
+            if (!is_subtract) {
+                for (size_t j = 0; j < range_size; j++) {
+                    range_sum_arr[j] += range_corr_value_arr[j];
+                }
+            }
+            else {
+                for (size_t j = 0; j < range_size; j++) {
+                    range_sum_arr[j] -= range_corr_value_arr[j];
+                }
+            }
+
+            i += range_size;
+            remainder = 0;
+        }
+    };
+
+    update_sums(new_corr_value_arr, new_remainder, false);
+    update_sums(old_corr_value_arr, old_remainder, true);
+
+    // the lock candidate of the period by the maximum weighted correlation mean value, where the lesser offset has a priority
+
+    const uint64_t stream_bit_size = first_offset + num_new_values;
+
+    period_lock = StreamSyncLock{ stream_bit_size, 0, 0, 0, 0 };
+
+    // the lock is calculated only by the full window
+    if (stream_bit_size - m_window_first_offset < m_window_bit_size) {
+        return;
+    }
+
+    const uint64_t window_first_offset = stream_bit_size - m_window_bit_size;
+
+    // the first offsets of the window have one more value
+    const uint64_t min_num_corr = m_window_bit_size / period;
+    const uint32_t num_extra_corr_offsets = uint32_t(m_window_bit_size % period);
+
+    // The offsets with the same number of values have the maximum weight by the maximum sum, so the weight is calculated only for the first offset
+    // of the maximum sum of each number of values.
+    //
+    const uint32_t first_remainder = uint32_t(window_first_offset % period);
+
+    // offset from the window begin of the zero remainder
+    const uint32_t zero_remainder_offset = period - first_remainder;
+
+    // returns the first offset of the maximum sum in the range of offsets [first; last) from the window begin
+    const auto find_max_sum_offset = [&](uint32_t first, uint32_t last) -> uint32_t {
+        uint32_t max_sum_offset = first;
+        uint64_t max_sum = 0;
+
+        for (uint32_t i = first, i_end = (std::min)(last, zero_remainder_offset); i < i_end; i++) {
+            if (max_sum < sum_arr[first_remainder + i]) {
+                max_sum = sum_arr[first_remainder + i];
+                max_sum_offset = i;
+            }
+        }
+
+        for (uint32_t i = (std::max)(first, zero_remainder_offset); i < last; i++) {
+            if (max_sum < sum_arr[i - zero_remainder_offset]) {
+                max_sum = sum_arr[i - zero_remainder_offset];
+                max_sum_offset = i;
+            }
+        }
+
+        return max_sum_offset;
+    };
+
+    double max_corr_mean_weight = 0;
+
+    const auto update_period_lock = [&](uint32_t offset, uint64_t num_corr) {
+        if (num_corr < m_min_num_corr) {
+            return;
+        }
+
+        const uint64_t sum = sum_arr[(uint64_t(first_remainder) + offset) % period];
+
+        const float corr_mean = float(double(sum) / (double(num_corr) * m_corr_value_scale));
+
+        if (corr_mean >= m_corr_in_params.corr_mean_min) {
+            const double corr_mean_weight = get_corr_mean_weight(corr_mean, uint32_t(num_corr), window_corr_mean);
+
+            if (max_corr_mean_weight < corr_mean_weight) {
+                max_corr_mean_weight = corr_mean_weight;
+                period_lock = StreamSyncLock{
+                    stream_bit_size, window_first_offset + offset, period, uint32_t((std::min)(num_corr, uint64_t(math::uint32_max))), corr_mean
+                };
+            }
+        }
+    };
+
+    if (num_extra_corr_offsets) {
+        update_period_lock(find_max_sum_offset(0, num_extra_corr_offsets), min_num_corr + 1);
+    }
+
+    update_period_lock(find_max_sum_offset(num_extra_corr_offsets, period), min_num_corr);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "correlation.hpp"
+#include "correlation_simd.hpp"
+#include "work_stealing_pool.hpp"
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+
+#define DEFAULT_STREAM_CHUNK_BYTE_SIZE 4096
+#define DEFAULT_TRACK_DRIFT_BIT_SIZE 2
+#define DEFAULT_TRACK_MAX_MISSES 3
+#define DEFAULT_LINEAR_TRACK_CORR_MIN 0.89f
+#define DEFAULT_QUADRATIC_TRACK_CORR_MIN 0.8f
+
+
+// Synchro sequence lock of a sliding window.
+//
+struct StreamSyncLock
+{
+    uint64_t                        stream_bit_size;                // number of the stream offsets processed when the lock is calculated
+    uint64_t                        offset;                         // absolute stream offset of the first synchro sequence in the window or of the last tracked one
+    uint32_t                        period;                         // stream width/period, 0 - not locked
+    uint32_t                        num_corr;                       // number of correlation values in the window used to calculate mean value
+    float                           corr_mean;                      // correlation mean (average) value as the lock confidence
+};
+
+// Lock tracking parameters after the lock acquisition.
+//
+struct StreamTrackParams
+{
+    uint32_t                        drift_bit_size;                 // maximal drift of the synchro sequence offset from the expected offset of the next period
+    uint32_t                        max_misses;                     // number of consecutive checks below the correlation minimum to reacquire the lock, 0 - no tracking
+    float                           corr_min;                       // correlation minimum of a check, must be greater than a correlation value of a random stream in the drift range
+};
+
+// Synchro sequence search over a not bounded bit stream by a sliding window of the last `corr_in_params.stream_bit_size` stream offsets.
+//
+//  The correlation values are calculated only for the new offsets and are stored as the fixed point values in a ring buffer of the window. The sums
+//  of the correlation values of each period and each offset remainder of a period are updated by add of the new value and subtract of the one that
+//  falls out of the window, so the sums are exact and do not accumulate an error in a long stream.
+//
+//  The lock is an offset and a period of the maximum weighted correlation mean value of the window, where the weight is the excess of the correlation
+//  mean value over the window correlation mean value multiplied by the square root of the number of values, so a divided or a multiplied period has
+//  less weight.
+//
+//  If the tracking is enabled, then after the lock acquisition the window is not updated and only the expected offsets of the synchro sequence are
+//  checked, where the offset is adjusted by the maximum correlation value in the drift range around the expected offset. If the number of
+//  consecutive checks below the correlation minimum reaches the limit, then the lock is dropped and the window is filled from the beginning.
+//
+//  Memory complexity:   O(W + T * T), where W - window bit length, T - maximum period
+//  Time complexity:     O(N * P), where N - stream bit length, P - number of periods
+//                       O(N / T * D) in the tracking, where D - drift bit length
+//
+class StreamSyncTracker
+{
+public:
+    // Writes back the calculated period range and the input inconsistency flag.
+    //
+    StreamSyncTracker(
+        const CorrInParams & corr_in_params, const StreamTrackParams & track_params, CorrInOutParams & corr_io_params, CorrOutParams & corr_out_params);
+
+    StreamSyncTracker(const StreamSyncTracker &) = delete;
+    StreamSyncTracker & operator =(const StreamSyncTracker &) = delete;
+
+    uint64_t window_bit_size() const
+    {
+        return m_window_bit_size;
+    }
+
+    // number of the processed stream offsets
+    uint64_t stream_bit_size() const
+    {
+        return m_stream_bit_size;
+    }
+
+    bool is_tracking() const
+    {
+        return m_is_tracking;
+    }
+
+    // number of the lock drops by the tracking
+    uint64_t num_reacquisitions() const
+    {
+        return m_num_reacquisitions;
+    }
+
+    // bytes of the correlation values ring buffer and the sums of the periods
+    uint64_t buffers_bytes() const
+    {
+        return m_window_bit_size * sizeof(uint16_t) + uint64_t(m_num_period_sums) * sizeof(uint64_t);
+    }
+
+    const StreamSyncLock & lock() const
+    {
+        return m_lock;
+    }
+
+    // Appends the stream bytes, calculates the correlation values of the new offsets and updates the window and the lock. The buffers are allocated
+    // by the first push. Returns true if the lock offset or period is changed.
+    //
+    //  The correlation values of the offsets of the last 32-bit block are calculated after the next block is appended.
+    //  The lock is calculated only when the window is full.
+    //  In the tracking the expected offset is checked after the bytes of the drift range are appended.
+    //
+    bool push_bytes(const uint8_t * buf, size_t size, CorrOutParams & corr_out_params);
+
+private:
+    bool acquire_lock(CorrOutParams & corr_out_params);
+    bool track_lock(CorrOutParams & corr_out_params);
+    void reset_window();
+    void calculate_corr_values(size_t num_blocks32, CorrOutParams & corr_out_params);
+    void update_period(size_t period_index, uint64_t first_offset, size_t num_new_values, float window_corr_mean, StreamSyncLock & period_lock);
+
+private:
+    CorrInParams                    m_corr_in_params;
+    StreamTrackParams               m_track_params;
+
+    uint64_t                        m_window_bit_size;
+    uint64_t                        m_stream_bit_size;
+    uint32_t                        m_min_period;
+    uint32_t                        m_max_period;
+    uint32_t                        m_min_num_corr;                 // minimal number of correlation values of an offset remainder to calculate the lock
+    bool                            m_input_inconsistency;
+
+    std::unique_ptr<CorrMultiplyTable> m_corr_multiply_table_ptr;
+    const CorrSimdKernels *         m_corr_simd_kernels_ptr;
+    CorrValuesBlockParams           m_corr_values_block_params;
+    CorrValuesBlockStats            m_corr_values_block_stats;
+    uint32_t                        m_syncseq_mask;
+    float                           m_corr_value_scale;
+    uint32_t                        m_fixed_corr_min;
+    uint32_t                        m_fixed_filtered_corr_value;
+
+    std::vector<uint8_t>            m_stream_buf;                   // not processed stream bytes beginning from a 32-bit block and padded by 2 blocks
+    size_t                          m_stream_buf_size;
+
+    std::vector<uint16_t>           m_corr_value_ring_arr;          // fixed point correlation values of the window
+    std::vector<uint16_t>           m_new_corr_value_arr;           // fixed point correlation values of the new offsets
+    std::vector<uint16_t>           m_old_corr_value_arr;           // fixed point correlation values falling out of the window by each new offset, 0 - not yet full window
+    uint64_t                        m_window_corr_sum;              // sum of the correlation values of the window
+    uint64_t                        m_window_first_offset;          // stream offset of the window fill beginning
+
+    std::vector<size_t>             m_period_sum_offset_arr;        // offset of the sums of a period in the sums array
+    size_t                          m_num_period_sums;
+    std::vector<uint64_t>           m_period_sum_arr;               // sums of the correlation values of each period by an offset remainder of a period
+    std::vector<StreamSyncLock>     m_period_lock_arr;              // lock candidate of each period
+
+    StreamSyncLock                  m_lock;
+
+    bool                            m_is_tracking;
+    uint32_t                        m_track_drift_bit_size;         // drift range limited by the half of the period
+    uint64_t                        m_track_offset;                 // expected stream offset of the next synchro sequence
+    uint32_t                        m_track_num_misses;             // number of consecutive checks below the correlation minimum
+    double                          m_track_corr_sum;               // sum of the maximum correlation values of the checks since the lock acquisition
+    uint64_t                        m_num_reacquisitions;
+
+    WorkStealingPool                m_pool;
+};
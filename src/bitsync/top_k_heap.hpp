@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+
+// Fixed capacity container of K best values by a predicate, which keeps the same values as a vector with the sorted insert and the resize back to
+// the capacity. The values with the equal order are kept in the insertion order, so an inserted value is not better than any previous equal value.
+//
+//  The worst value is at the top of a binary heap, so when the container is full, a value which is not better than the worst value is rejected by
+//  a single compare. Otherwise the insertion time complexity is O(log(K)) instead of O(K) element moves for the vector.
+//
+//  pred:   bool(const T & l, const T & r), returns true if `l` is better than `r`
+//
+template <typename T, typename Pred>
+class TopKHeap
+{
+    struct Item
+    {
+        T                           value;
+        uint64_t                    index;                          // insertion index
+    };
+
+public:
+    TopKHeap(size_t capacity, Pred pred) :
+        m_capacity(capacity), m_next_index(0), m_pred(pred)
+    {
+        m_item_arr.reserve(capacity);
+    }
+
+    void clear()
+    {
+        m_item_arr.clear();
+        m_next_index = 0;
+    }
+
+    size_t size() const
+    {
+        return m_item_arr.size();
+    }
+
+    // returns false if the value is rejected
+    bool push(const T & value)
+    {
+        const Item item{ value, m_next_index++ };
+
+        if (m_item_arr.size() < m_capacity) {
+            m_item_arr.push_back(item);
+            std::push_heap(m_item_arr.begin(), m_item_arr.end(), ItemPred{ m_pred });
+            return true;
+        }
+
+        if (!m_capacity || !is_better(item, m_item_arr.front(), m_pred)) {
+            return false;
+        }
+
+        // replace the worst value
+        std::pop_heap(m_item_arr.begin(), m_item_arr.end(), ItemPred{ m_pred });
+        m_item_arr.back() = item;
+        std::push_heap(m_item_arr.begin(), m_item_arr.end(), ItemPred{ m_pred });
+
+        return true;
+    }
+
+    // moves out the values sorted from the best to the worst and clears the container
+    void extract_sorted(std::vector<T> & value_arr)
+    {
+        std::sort(m_item_arr.begin(), m_item_arr.end(), ItemPred{ m_pred });
+
+        value_arr.clear();
+        value_arr.reserve(m_item_arr.size());
+
+        for (const auto & item : m_item_arr) {
+            value_arr.push_back(item.value);
+        }
+
+        clear();
+    }
+
+private:
+    static inline bool is_better(const Item & l, const Item & r, const Pred & pred)
+    {
+        return pred(l.value, r.value) || (!pred(r.value, l.value) && l.index < r.index);
+    }
+
+    // `less` for the heap functions to keep the worst item at the top and for the sort from the best to the worst
+    struct ItemPred
+    {
+        const Pred &                pred;
+
+        bool operator()(const Item & l, const Item & r) const
+        {
+            return is_better(l, r, pred);
+        }
+    };
+
+private:
+    std::vector<Item>               m_item_arr;
+    size_t                          m_capacity;
+    uint64_t                        m_next_index;
+    Pred                            m_pred;
+};
@@ -0,0 +1,193 @@
+// Author: Andrey Dibrov (andry at inbox dot ru)
+//
+
+#include "work_stealing_pool.hpp"
+
+#include <algorithm>
+
+
+WorkStealingPool::WorkStealingPool(size_t num_workers) :
+    m_run_index(0), m_num_running_threads(0), m_is_shutdown(false), m_item_func_ptr(nullptr), m_is_canceled(false)
+{
+    if (!num_workers) {
+        num_workers = (std::max)(std::thread::hardware_concurrency(), 1U);
+    }
+
+    m_worker_range_arr.reserve(num_workers);
+
+    for (size_t i = 0; i < num_workers; i++) {
+        m_worker_range_arr.emplace_back(new WorkerRange{});
+    }
+
+    // the first worker is the calling thread
+    m_thread_arr.reserve(num_workers - 1);
+
+    for (size_t i = 1; i < num_workers; i++) {
+        m_thread_arr.emplace_back(&WorkStealingPool::worker_thread, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_is_shutdown = true;
+    }
+
+    m_run_cond.notify_all();
+
+    for (auto & thread : m_thread_arr) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::run(uint64_t num_items, const item_func_type & item_func)
+{
+    const size_t num_workers = m_worker_range_arr.size();
+
+    // split the range into contiguous parts
+    for (size_t i = 0; i < num_workers; i++) {
+        WorkerRange & worker_range = *m_worker_range_arr[i];
+
+        std::lock_guard<std::mutex> lock{ worker_range.mutex };
+
+        worker_range.begin = num_items / num_workers * i + (std::min)(num_items % num_workers, uint64_t(i));
+        worker_range.end = num_items / num_workers * (i + 1) + (std::min)(num_items % num_workers, uint64_t(i + 1));
+    }
+
+    m_is_canceled = false;
+    m_exception_ptr = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+
+        m_item_func_ptr = &item_func;
+        m_num_running_threads = m_thread_arr.size();
+        m_run_index++;
+    }
+
+    m_run_cond.notify_all();
+
+    process_items(0);
+
+    {
+        std::unique_lock<std::mutex> lock{ m_mutex };
+
+        m_done_cond.wait(lock, [&]() -> bool {
+            return !m_num_running_threads;
+        });
+
+        m_item_func_ptr = nullptr;
+    }
+
+    if (m_exception_ptr) {
+        std::rethrow_exception(m_exception_ptr);
+    }
+}
+
+bool WorkStealingPool::pop_item(size_t worker_index, uint64_t & item_index)
+{
+    WorkerRange & worker_range = *m_worker_range_arr[worker_index];
+
+    std::lock_guard<std::mutex> lock{ worker_range.mutex };
+
+    if (worker_range.begin < worker_range.end) {
+        item_index = worker_range.begin++;
+        return true;
+    }
+
+    return false;
+}
+
+bool WorkStealingPool::steal_item(size_t worker_index, uint64_t & item_index)
+{
+    const size_t num_workers = m_worker_range_arr.size();
+
+    for (size_t i = 1; i < num_workers; i++) {
+        WorkerRange & victim_range = *m_worker_range_arr[(worker_index + i) % num_workers];
+
+        uint64_t begin;
+        uint64_t end;
+
+        {
+            std::lock_guard<std::mutex> lock{ victim_range.mutex };
+
+            if (victim_range.begin >= victim_range.end) {
+                continue;
+            }
+
+            // steal a half from the end, rounding to greater
+            end = victim_range.end;
+            begin = end - (end - victim_range.begin + 1) / 2;
+
+            victim_range.end = begin;
+        }
+
+        // CAUTION:
+        //  The own range is empty here, so nobody can steal from it until the update.
+        //
+        WorkerRange & worker_range = *m_worker_range_arr[worker_index];
+
+        std::lock_guard<std::mutex> lock{ worker_range.mutex };
+
+        item_index = begin;
+
+        worker_range.begin = begin + 1;
+        worker_range.end = end;
+
+        return true;
+    }
+
+    return false;
+}
+
+void WorkStealingPool::process_items(size_t worker_index)
+{
+    uint64_t item_index;
+
+    while (!m_is_canceled && (pop_item(worker_index, item_index) || steal_item(worker_index, item_index))) {
+        try {
+            (*m_item_func_ptr)(worker_index, item_index);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+
+            if (!m_exception_ptr) {
+                m_exception_ptr = std::current_exception();
+            }
+
+            m_is_canceled = true;
+        }
+    }
+}
+
+void WorkStealingPool::worker_thread(size_t worker_index)
+{
+    uint64_t last_run_index = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock{ m_mutex };
+
+            m_run_cond.wait(lock, [&]() -> bool {
+                return m_is_shutdown || m_run_index != last_run_index;
+            });
+
+            if (m_is_shutdown) {
+                break;
+            }
+
+            last_run_index = m_run_index;
+        }
+
+        process_items(worker_index);
+
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+
+            if (!--m_num_running_threads) {
+                m_done_cond.notify_one();
+            }
+        }
+    }
+}
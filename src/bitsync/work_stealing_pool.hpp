@@ -0,0 +1,165 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <cstdint>
+#include <cstddef>
+
+#define ORDERED_RUN_MAX_PENDING_ITEMS_PER_WORKER    2   // maximal number of calculated but not merged results of an ordered run per worker
+
+
+// Pool of worker threads to process a range of items.
+//
+//  Each worker processes its own part of the range from the begin and when the part is over, steals a half of the rest of a part of another worker
+//  from the end. The calling thread is the first worker, so the pool of 1 worker does not create any thread.
+//
+class WorkStealingPool
+{
+public:
+    using item_func_type = std::function<void(size_t worker_index, uint64_t item_index)>;
+
+    // 0 - number of the processor hardware threads
+    explicit WorkStealingPool(size_t num_workers);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool & operator =(const WorkStealingPool &) = delete;
+
+    size_t num_workers() const
+    {
+        return m_worker_range_arr.size();
+    }
+
+    // Calls the function for each item of the range [0; num_items) and returns after all the items are processed or the run is canceled.
+    // Rethrows the first exception thrown by the function.
+    //
+    void run(uint64_t num_items, const item_func_type & item_func);
+
+    // Calculates the results of the range [0; num_items) in parallel, but merges them strictly in the item order, so the merged result does not depend
+    // on the number of workers. The merge function must return false to cancel the run, then the rest items are not merged.
+    //
+    //  The items are taken one by one in the item order instead of the parts of the range, and a worker waits while the item is too far from the
+    //  next merged item, so not more than `ORDERED_RUN_MAX_PENDING_ITEMS_PER_WORKER` results per worker are calculated but not merged.
+    //
+    //  calc_func:      void(size_t worker_index, uint64_t item_index, Result & result)
+    //  merge_func:     bool(uint64_t item_index, Result & result)
+    //
+    template <typename Result, typename CalcFunc, typename MergeFunc>
+    void run_ordered(uint64_t num_items, CalcFunc calc_func, MergeFunc merge_func);
+
+    // stops to take new items by the current run
+    void cancel()
+    {
+        m_is_canceled = true;
+    }
+
+    bool is_canceled() const
+    {
+        return m_is_canceled;
+    }
+
+private:
+    struct WorkerRange
+    {
+        std::mutex                  mutex;
+        uint64_t                    begin;
+        uint64_t                    end;
+    };
+
+    bool pop_item(size_t worker_index, uint64_t & item_index);
+    bool steal_item(size_t worker_index, uint64_t & item_index);
+
+    void process_items(size_t worker_index);
+    void worker_thread(size_t worker_index);
+
+private:
+    std::vector<std::unique_ptr<WorkerRange> > m_worker_range_arr;
+    std::vector<std::thread>        m_thread_arr;
+
+    std::mutex                      m_mutex;
+    std::condition_variable         m_run_cond;
+    std::condition_variable         m_done_cond;
+    uint64_t                        m_run_index;
+    size_t                          m_num_running_threads;
+    bool                            m_is_shutdown;
+
+    const item_func_type *          m_item_func_ptr;
+    std::atomic<bool>               m_is_canceled;
+    std::exception_ptr              m_exception_ptr;
+};
+
+template <typename Result, typename CalcFunc, typename MergeFunc>
+inline void WorkStealingPool::run_ordered(uint64_t num_items, CalcFunc calc_func, MergeFunc merge_func)
+{
+    const uint64_t max_pending_items = uint64_t(num_workers()) * ORDERED_RUN_MAX_PENDING_ITEMS_PER_WORKER;
+
+    std::mutex merge_mutex;
+    std::condition_variable merge_cond;
+
+    // not merged results, which are waiting for the results of the items before
+    std::map<uint64_t, Result> result_map;
+
+    uint64_t next_item_index = 0;
+    uint64_t next_merge_item_index = 0;
+
+    // CAUTION:
+    //  The items are taken strictly in the item order, so the next merged item is always in calculation by a not waiting worker.
+    //
+    run(num_workers(), [&](size_t worker_index, uint64_t) {
+        for (;;) {
+            uint64_t item_index;
+
+            {
+                std::unique_lock<std::mutex> lock{ merge_mutex };
+
+                merge_cond.wait(lock, [&]() -> bool {
+                    return m_is_canceled || next_item_index >= num_items || next_item_index < next_merge_item_index + max_pending_items;
+                });
+
+                if (m_is_canceled || next_item_index >= num_items) {
+                    break;
+                }
+
+                item_index = next_item_index++;
+            }
+
+            Result result{};
+
+            try {
+                calc_func(worker_index, item_index, result);
+            }
+            catch (...) {
+                // wake up the waiting workers, because the item is never merged
+                {
+                    std::lock_guard<std::mutex> lock{ merge_mutex };
+                    cancel();
+                }
+
+                merge_cond.notify_all();
+
+                throw;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{ merge_mutex };
+
+                result_map.emplace(item_index, std::move(result));
+
+                for (auto it = result_map.begin(); it != result_map.end() && it->first == next_merge_item_index; it = result_map.erase(it), next_merge_item_index++) {
+                    if (!m_is_canceled && !merge_func(it->first, it->second)) {
+                        cancel();
+                    }
+                }
+            }
+
+            merge_cond.notify_all();
+        }
+    });
+}